@@ -0,0 +1,209 @@
+/**
+ *  Allocator.cpp
+ *
+ *  Implementation file for the Allocator class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "allocator.h"
+#include <cstring>
+#include <cstdint>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Number of bytes in use, and the highest number ever in use
+ *  @var std::atomic<size_t>
+ */
+std::atomic<size_t> Allocator::_live = 0;
+std::atomic<size_t> Allocator::_peak = 0;
+
+/**
+ *  Constructor
+ *  @param  limit       maximum number of bytes in use (zero for no limit)
+ */
+Allocator::Allocator(size_t limit) :
+    _allocator(v8::ArrayBuffer::Allocator::NewDefaultAllocator()),
+    _limit(limit) {}
+
+/**
+ *  Destructor
+ */
+Allocator::~Allocator()
+{
+    // release the pooled buffers
+    for (size_t i = 0; i <= maxshift - minshift; ++i)
+    {
+        // all buffers in the pool have the size of the class
+        for (auto *data : _pools[i]) _allocator->Free(data, size_t(1) << (i + minshift));
+    }
+}
+
+/**
+ *  The size class for a buffer
+ *  @param  length      size of the buffer
+ *  @return size_t      index of the pool, or SIZE_MAX if the buffer is not pooled
+ */
+size_t Allocator::sizeclass(size_t length)
+{
+    // big buffers are not pooled (and empty buffers do not have to be)
+    if (length == 0 || length > (size_t(1) << maxshift)) return SIZE_MAX;
+
+    // the smallest class that fits the buffer
+    size_t shift = length <= (size_t(1) << minshift) ? minshift : 64 - __builtin_clzll(length - 1);
+
+    // expose the index of the pool
+    return shift - minshift;
+}
+
+/**
+ *  Register that bytes are taken into use
+ *  @param  length      number of bytes
+ *  @return bool        false if the limit would be exceeded
+ */
+bool Allocator::reserve(size_t length)
+{
+    // update the counter
+    size_t live = _live.fetch_add(length) + length;
+
+    // check the limit
+    if (_limit > 0 && live > _limit) { _live.fetch_sub(length); return false; }
+
+    // update the peak
+    size_t peak = _peak.load();
+    while (live > peak && !_peak.compare_exchange_weak(peak, live)) {}
+
+    // allowed
+    return true;
+}
+
+/**
+ *  Allocate memory that is initialized to zero
+ *  @param  length      size of the buffer
+ *  @return void*       nullptr if the memory could not be allocated
+ */
+void *Allocator::Allocate(size_t length)
+{
+    // get uninitialized memory
+    void *data = AllocateUninitialized(length);
+
+    // initialize it (unless the allocation failed)
+    if (data != nullptr && length > 0) memset(data, 0, length);
+
+    // done
+    return data;
+}
+
+/**
+ *  Allocate memory that is not initialized
+ *  @param  length      size of the buffer
+ *  @return void*       nullptr if the memory could not be allocated
+ */
+void *Allocator::AllocateUninitialized(size_t length)
+{
+    // check the limit
+    if (!reserve(length)) return nullptr;
+
+    // the pool for this size
+    size_t index = sizeclass(length);
+
+    // big buffers are allocated directly
+    if (index == SIZE_MAX)
+    {
+        // allocate the buffer
+        void *data = _allocator->AllocateUninitialized(length);
+
+        // if that failed, the bytes are not in use after all
+        if (data == nullptr) _live.fetch_sub(length);
+
+        // done
+        return data;
+    }
+
+    // check if there is a free buffer in the pool
+    {
+        // lock the pools
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // reuse the last free buffer
+        if (!_pools[index].empty())
+        {
+            // take the buffer from the pool
+            void *data = _pools[index].back();
+            _pools[index].pop_back();
+
+            // done
+            return data;
+        }
+    }
+
+    // allocate a buffer with the size of the class, so that it can be reused for all sizes in the class
+    void *data = _allocator->AllocateUninitialized(size_t(1) << (index + minshift));
+
+    // if that failed, the bytes are not in use after all
+    if (data == nullptr) _live.fetch_sub(length);
+
+    // done
+    return data;
+}
+
+/**
+ *  Release memory
+ *  @param  data        the buffer
+ *  @param  length      size of the buffer
+ */
+void Allocator::Free(void *data, size_t length)
+{
+    // the bytes are no longer in use
+    _live.fetch_sub(length);
+
+    // the pool for this size
+    size_t index = sizeclass(length);
+
+    // big buffers are released directly
+    if (index == SIZE_MAX) { _allocator->Free(data, length); return; }
+
+    // put the buffer back in the pool, if there is room
+    {
+        // lock the pools
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // is there room in the pool?
+        if (_pools[index].size() < poolsize) { _pools[index].push_back(data); return; }
+    }
+
+    // the pool is full, so the buffer is released
+    _allocator->Free(data, size_t(1) << (index + minshift));
+}
+
+/**
+ *  Create an ArrayBuffer with memory that is not initialized
+ *  @param  isolate     the isolate
+ *  @param  length      size of the buffer
+ *  @return v8::Local<v8::ArrayBuffer>
+ *  @throws Php::Exception
+ */
+v8::Local<v8::ArrayBuffer> Allocator::buffer(v8::Isolate *isolate, size_t length)
+{
+    // allocate the memory (v8::ArrayBuffer::New() would abort the process on failure)
+    auto store = v8::ArrayBuffer::NewBackingStore(isolate, length, v8::BackingStoreInitializationMode::kUninitialized, v8::BackingStoreOnFailureMode::kReturnNull);
+
+    // check for success
+    if (store == nullptr) throw Php::Exception("Unable to allocate a buffer of " + std::to_string(length) + " bytes");
+
+    // create the buffer
+    return v8::ArrayBuffer::New(isolate, std::move(store));
+}
+
+/**
+ *  End of namespace
+ */
+}
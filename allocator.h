@@ -0,0 +1,168 @@
+/**
+ *  Allocator.h
+ *
+ *  The allocator for the memory of ArrayBuffers. It passes the allocations
+ *  on to the default allocator of v8 (which takes care of allocating inside
+ *  the sandbox), but small buffers are pooled per size class, because
+ *  scripts tend to create and drop many of them. It also keeps track of
+ *  the number of bytes in use, and fails allocations that would exceed
+ *  the configured limit (v8 then throws a RangeError).
+ *
+ *  The isolate (and thus the allocator) is shared by all contexts, so the
+ *  limit applies to all of them together.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class Allocator : public v8::ArrayBuffer::Allocator
+{
+private:
+    /**
+     *  The smallest and the biggest size class (as a power of two), bigger
+     *  buffers are not pooled
+     *  @var size_t
+     */
+    static constexpr size_t minshift = 4;
+    static constexpr size_t maxshift = 12;
+
+    /**
+     *  Maximum number of free buffers per size class
+     *  @var size_t
+     */
+    static constexpr size_t poolsize = 64;
+
+    /**
+     *  Number of bytes in use, and the highest number ever in use
+     *  @var std::atomic<size_t>
+     */
+    static std::atomic<size_t> _live;
+    static std::atomic<size_t> _peak;
+
+    /**
+     *  The allocator that does the actual work
+     *  @var std::unique_ptr<v8::ArrayBuffer::Allocator>
+     */
+    std::unique_ptr<v8::ArrayBuffer::Allocator> _allocator;
+
+    /**
+     *  Maximum number of bytes in use (zero for no limit)
+     *  @var size_t
+     */
+    size_t _limit;
+
+    /**
+     *  The free buffers per size class
+     *  @var std::vector<void*>
+     */
+    std::vector<void *> _pools[maxshift - minshift + 1];
+
+    /**
+     *  Mutex to protect the pools (v8 may free buffers from a different thread)
+     *  @var std::mutex
+     */
+    std::mutex _mutex;
+
+    /**
+     *  The size class for a buffer
+     *  @param  length      size of the buffer
+     *  @return size_t      index of the pool, or SIZE_MAX if the buffer is not pooled
+     */
+    static size_t sizeclass(size_t length);
+
+    /**
+     *  Register that bytes are taken into use
+     *  @param  length      number of bytes
+     *  @return bool        false if the limit would be exceeded
+     */
+    bool reserve(size_t length);
+
+public:
+    /**
+     *  Constructor
+     *  @param  limit       maximum number of bytes in use (zero for no limit)
+     */
+    Allocator(size_t limit);
+
+    /**
+     *  No copying
+     *  @param  that
+     */
+    Allocator(const Allocator &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~Allocator();
+
+    /**
+     *  Allocate memory that is initialized to zero
+     *  @param  length      size of the buffer
+     *  @return void*       nullptr if the memory could not be allocated
+     */
+    virtual void *Allocate(size_t length) override;
+
+    /**
+     *  Allocate memory that is not initialized
+     *  @param  length      size of the buffer
+     *  @return void*       nullptr if the memory could not be allocated
+     */
+    virtual void *AllocateUninitialized(size_t length) override;
+
+    /**
+     *  Release memory
+     *  @param  data        the buffer
+     *  @param  length      size of the buffer
+     */
+    virtual void Free(void *data, size_t length) override;
+
+    /**
+     *  Create an ArrayBuffer with memory that is not initialized, this throws instead of
+     *  aborting the process when the memory cannot be allocated (because of the limit)
+     *  @param  isolate     the isolate
+     *  @param  length      size of the buffer
+     *  @return v8::Local<v8::ArrayBuffer>
+     *  @throws Php::Exception
+     */
+    static v8::Local<v8::ArrayBuffer> buffer(v8::Isolate *isolate, size_t length);
+
+    /**
+     *  Number of bytes in use
+     *  @return size_t
+     */
+    static size_t live() { return _live; }
+
+    /**
+     *  Highest number of bytes ever in use
+     *  @return size_t
+     */
+    static size_t peak() { return _peak; }
+};
+
+/**
+ *  End of namespace
+ */
+}
@@ -0,0 +1,304 @@
+/**
+ *  ArrayMethods.cpp
+ *
+ *  Implementation file for the ArrayMethods class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "arraymethods.h"
+#include "scope.h"
+#include "linker.h"
+#include "fromphp.h"
+#include "exception.h"
+#include "zendvalue.h"
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  The templates for the methods
+ *  @var v8::Global<v8::FunctionTemplate>
+ */
+v8::Global<v8::FunctionTemplate> ArrayMethods::_map;
+v8::Global<v8::FunctionTemplate> ArrayMethods::_filter;
+v8::Global<v8::FunctionTemplate> ArrayMethods::_reduce;
+v8::Global<v8::FunctionTemplate> ArrayMethods::_forEach;
+
+/**
+ *  Helper function to convert all elements of a hashtable in one pass
+ *  @param  isolate     the isolate
+ *  @param  table       the hashtable to walk
+ *  @param  keys        vector to be filled with the keys (or nullptr if not needed)
+ *  @param  values      vector to be filled with the values
+ */
+static void convert(v8::Isolate *isolate, HashTable *table, std::vector<v8::Local<v8::Value>> *keys, std::vector<v8::Local<v8::Value>> &values)
+{
+    // reserve all space up front
+    values.reserve(zend_hash_num_elements(table));
+    if (keys) keys->reserve(zend_hash_num_elements(table));
+
+    // variables for the loop
+    zend_ulong index; zend_string *key; zval *element;
+
+    // walk over the table
+    ZEND_HASH_FOREACH_KEY_VAL(table, index, key, element)
+    {
+        // the array may hold references
+        ZVAL_DEREF(element);
+
+        // convert the value
+        values.push_back(FromPhp(isolate, Php::Value(element)));
+
+        // convert the key if needed
+        if (keys == nullptr) continue;
+
+        // numeric keys are passed as numbers, and string keys as strings
+        if (key == nullptr) keys->push_back(v8::Number::New(isolate, static_cast<double>(index)));
+        else keys->push_back(v8::String::NewFromUtf8(isolate, ZSTR_VAL(key), v8::NewStringType::kNormal, ZSTR_LEN(key)).ToLocalChecked());
+    }
+    ZEND_HASH_FOREACH_END();
+}
+
+/**
+ *  Helper method to get the function for a certain template
+ *  @param  isolate     the isolate
+ *  @param  tpl         the template (created if it does not yet exist)
+ *  @param  callback    the implementation of the method
+ *  @param  length      number of declared parameters
+ *  @return v8::Local<v8::Function>
+ */
+v8::Local<v8::Function> ArrayMethods::function(v8::Isolate *isolate, v8::Global<v8::FunctionTemplate> &tpl, v8::FunctionCallback callback, int length)
+{
+    // create the template the first time it is used
+    if (tpl.IsEmpty()) tpl.Reset(isolate, v8::FunctionTemplate::New(isolate, callback, v8::Local<v8::Value>(), v8::Local<v8::Signature>(), length, v8::ConstructorBehavior::kThrow));
+
+    // v8 caches the function per context, so this is cheap
+    return tpl.Get(isolate)->GetFunction(isolate->GetCurrentContext()).ToLocalChecked();
+}
+
+/**
+ *  Look up a method by its name
+ *  @param  isolate     the isolate
+ *  @param  name        name of the method
+ *  @return v8::Local<v8::Function>     empty if there is no such method
+ */
+v8::Local<v8::Function> ArrayMethods::lookup(v8::Isolate *isolate, zend_string *name)
+{
+    // check the supported methods
+    if (zend_string_equals_literal(name, "map"))        return function(isolate, _map, &ArrayMethods::map, 1);
+    if (zend_string_equals_literal(name, "filter"))     return function(isolate, _filter, &ArrayMethods::filter, 1);
+    if (zend_string_equals_literal(name, "reduce"))     return function(isolate, _reduce, &ArrayMethods::reduce, 1);
+    if (zend_string_equals_literal(name, "forEach"))    return function(isolate, _forEach, &ArrayMethods::forEach, 1);
+
+    // not a supported method
+    return v8::Local<v8::Function>();
+}
+
+/**
+ *  Helper method to convert all elements in the array that is being called
+ *  @param  info        callback info
+ *  @param  keys        vector to be filled with the keys
+ *  @param  values      vector to be filled with the values
+ *  @return bool        false when an exception was thrown
+ */
+bool ArrayMethods::elements(const v8::FunctionCallbackInfo<v8::Value> &info, std::vector<v8::Local<v8::Value>> &keys, std::vector<v8::Local<v8::Value>> &values)
+{
+    // we need the isolate
+    auto *isolate = info.GetIsolate();
+
+    // avoid exceptions
+    try
+    {
+        // the object that is being accessed
+        Php::Value object = Linker(isolate, info.This()).value();
+
+        // this should be a PHP array
+        if (!object.isArray()) return isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8Literal(isolate, "Method called on incompatible receiver"))), false;
+
+        // the callback must be a function
+        if (!info[0]->IsFunction()) return isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8Literal(isolate, "Callback is not a function"))), false;
+
+        // convert all elements
+        convert(isolate, Z_ARRVAL_P(ZendValue::get(object)), &keys, values);
+
+        // success
+        return true;
+    }
+    catch (const Php::Exception &exception)
+    {
+        // pass the exception on to javascript userspace
+        isolate->ThrowException(Exception(isolate, exception));
+
+        // failure
+        return false;
+    }
+}
+
+/**
+ *  Implementation of Array.prototype.map
+ *  @param  info        callback info
+ */
+void ArrayMethods::map(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    // we need the isolate
+    auto *isolate = info.GetIsolate();
+
+    // create handle-scope
+    Scope scope(isolate);
+
+    // convert all elements
+    std::vector<v8::Local<v8::Value>> keys, values;
+    if (!elements(info, keys, values)) return;
+
+    // the callback and the "this" to pass to it
+    auto callback = info[0].As<v8::Function>();
+    auto self = info[1];
+
+    // call the function for each element
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        // the arguments to pass
+        v8::Local<v8::Value> args[] = { values[i], keys[i], info.This() };
+
+        // call the function (stop on exceptions) and replace the value with the result
+        if (!callback->Call(scope, self, 3, args).ToLocal(&values[i])) return;
+    }
+
+    // return a real array
+    info.GetReturnValue().Set(v8::Array::New(isolate, values.data(), values.size()));
+}
+
+/**
+ *  Implementation of Array.prototype.filter
+ *  @param  info        callback info
+ */
+void ArrayMethods::filter(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    // we need the isolate
+    auto *isolate = info.GetIsolate();
+
+    // create handle-scope
+    Scope scope(isolate);
+
+    // convert all elements
+    std::vector<v8::Local<v8::Value>> keys, values;
+    if (!elements(info, keys, values)) return;
+
+    // the callback and the "this" to pass to it
+    auto callback = info[0].As<v8::Function>();
+    auto self = info[1];
+
+    // the elements that pass the filter
+    std::vector<v8::Local<v8::Value>> result;
+
+    // call the function for each element
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        // the arguments to pass
+        v8::Local<v8::Value> args[] = { values[i], keys[i], info.This() };
+
+        // call the function (stop on exceptions)
+        v8::Local<v8::Value> retval;
+        if (!callback->Call(scope, self, 3, args).ToLocal(&retval)) return;
+
+        // keep the element if the callback returned something truthy
+        if (retval->BooleanValue(isolate)) result.push_back(values[i]);
+    }
+
+    // return a real array
+    info.GetReturnValue().Set(v8::Array::New(isolate, result.data(), result.size()));
+}
+
+/**
+ *  Implementation of Array.prototype.reduce
+ *  @param  info        callback info
+ */
+void ArrayMethods::reduce(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    // we need the isolate
+    auto *isolate = info.GetIsolate();
+
+    // create handle-scope
+    Scope scope(isolate);
+
+    // convert all elements
+    std::vector<v8::Local<v8::Value>> keys, values;
+    if (!elements(info, keys, values)) return;
+
+    // the callback
+    auto callback = info[0].As<v8::Function>();
+
+    // if no initial value is passed, we start with the first element
+    size_t start = info.Length() > 1 ? 0 : 1;
+
+    // this is not possible for empty arrays
+    if (start > values.size()) return (void)isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8Literal(isolate, "Reduce of empty array with no initial value")));
+
+    // the initial value
+    v8::Local<v8::Value> accumulator = start == 0 ? info[1] : values[0];
+
+    // call the function for each element
+    for (size_t i = start; i < values.size(); ++i)
+    {
+        // the arguments to pass
+        v8::Local<v8::Value> args[] = { accumulator, values[i], keys[i], info.This() };
+
+        // call the function (stop on exceptions)
+        if (!callback->Call(scope, v8::Undefined(isolate), 4, args).ToLocal(&accumulator)) return;
+    }
+
+    // expose the result
+    info.GetReturnValue().Set(accumulator);
+}
+
+/**
+ *  Implementation of Array.prototype.forEach
+ *  @param  info        callback info
+ */
+void ArrayMethods::forEach(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    // create handle-scope
+    Scope scope(info.GetIsolate());
+
+    // convert all elements
+    std::vector<v8::Local<v8::Value>> keys, values;
+    if (!elements(info, keys, values)) return;
+
+    // the callback and the "this" to pass to it
+    auto callback = info[0].As<v8::Function>();
+    auto self = info[1];
+
+    // call the function for each element
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        // the arguments to pass
+        v8::Local<v8::Value> args[] = { values[i], keys[i], info.This() };
+
+        // call the function (stop on exceptions)
+        if (callback->Call(scope, self, 3, args).IsEmpty()) return;
+    }
+}
+
+/**
+ *  Forget the templates (must be called before the isolate is disposed)
+ */
+void ArrayMethods::reset()
+{
+    // forget all handles
+    _map.Reset();
+    _filter.Reset();
+    _reduce.Reset();
+    _forEach.Reset();
+}
+
+/**
+ *  End of namespace
+ */
+}
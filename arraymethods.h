@@ -0,0 +1,98 @@
+/**
+ *  ArrayMethods.h
+ *
+ *  PHP arrays that are exposed to javascript are not real javascript arrays,
+ *  so they do not inherit the methods from Array.prototype. This class
+ *  implements the most common of these methods (map, filter, reduce and
+ *  forEach) in C++. They walk the underlying hashtable directly, and convert
+ *  all elements in one pass, instead of going through the interceptors for
+ *  every element.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+#include <vector>
+
+/**
+ *  Forward declarations
+ */
+struct _zend_string;
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class ArrayMethods
+{
+private:
+    /**
+     *  The templates for the methods, created when they are first used
+     *  @var v8::Global<v8::FunctionTemplate>
+     */
+    static v8::Global<v8::FunctionTemplate> _map;
+    static v8::Global<v8::FunctionTemplate> _filter;
+    static v8::Global<v8::FunctionTemplate> _reduce;
+    static v8::Global<v8::FunctionTemplate> _forEach;
+
+    /**
+     *  Helper method to get the function for a certain template
+     *  @param  isolate     the isolate
+     *  @param  tpl         the template (created if it does not yet exist)
+     *  @param  callback    the implementation of the method
+     *  @param  length      number of declared parameters
+     *  @return v8::Local<v8::Function>
+     */
+    static v8::Local<v8::Function> function(v8::Isolate *isolate, v8::Global<v8::FunctionTemplate> &tpl, v8::FunctionCallback callback, int length);
+
+    /**
+     *  Helper method to convert all elements in the array that is being called
+     *  @param  info        callback info
+     *  @param  keys        vector to be filled with the keys
+     *  @param  values      vector to be filled with the values
+     *  @return bool        false when an exception was thrown
+     */
+    static bool elements(const v8::FunctionCallbackInfo<v8::Value> &info, std::vector<v8::Local<v8::Value>> &keys, std::vector<v8::Local<v8::Value>> &values);
+
+    /**
+     *  The implementations of the methods
+     *  @param  info        callback info
+     */
+    static void map(const v8::FunctionCallbackInfo<v8::Value> &info);
+    static void filter(const v8::FunctionCallbackInfo<v8::Value> &info);
+    static void reduce(const v8::FunctionCallbackInfo<v8::Value> &info);
+    static void forEach(const v8::FunctionCallbackInfo<v8::Value> &info);
+
+public:
+    /**
+     *  Look up a method by its name
+     *  @param  isolate     the isolate
+     *  @param  name        name of the method
+     *  @return v8::Local<v8::Function>     empty if there is no such method
+     */
+    static v8::Local<v8::Function> lookup(v8::Isolate *isolate, struct _zend_string *name);
+
+    /**
+     *  Forget the templates (must be called before the isolate is disposed)
+     */
+    static void reset();
+};
+
+/**
+ *  End of namespace
+ */
+}
@@ -0,0 +1,15 @@
+<?php
+/**
+ *  Allocator.php
+ *
+ *  Benchmark for allocating many small array buffers
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+$start = microtime(true);
+$context->evaluate("let n = 0; for (let i = 0; i < 1000000; i++) n += new Uint8Array(64).length; n");
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
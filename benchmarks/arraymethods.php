@@ -0,0 +1,16 @@
+<?php
+/**
+ *  Arraymethods.php
+ *
+ *  Benchmark for calling array methods on a PHP array
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+$context->assign('list', range(1, 1000000));
+
+$start = microtime(true);
+$context->evaluate("list.map(x => x * 2).filter(x => x % 3 == 0).reduce((a, b) => a + b, 0)");
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
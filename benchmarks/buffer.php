@@ -0,0 +1,19 @@
+<?php
+/**
+ *  Buffer.php
+ *
+ *  Benchmark for passing large binary buffers to javascript
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$data = '';
+for ($i = 0; $i < 256; $i++) $data .= chr($i);
+$large = str_repeat($data, 4096);
+
+$context = new JS\Context();
+
+$start = microtime(true);
+for ($i = 0; $i < 1000; $i++) $context->assign('large', new JS\Buffer($large));
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
@@ -0,0 +1,19 @@
+<?php
+/**
+ *  Conversion.php
+ *
+ *  Benchmark for reading a copied PHP array in javascript
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$config = ['debug' => true, 'levels' => [1, 2, 3]];
+
+$context = new JS\Context();
+$context->setConversion(JS\Auto, 16, 4);
+$context->assign('config', $config);
+
+$start = microtime(true);
+$context->evaluate("let sum = 0; for (let i = 0; i < 1000000; i++) sum += config.levels[i % 3]; sum");
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
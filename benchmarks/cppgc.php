@@ -0,0 +1,22 @@
+<?php
+/**
+ *  Cppgc.php
+ *
+ *  Benchmark for passing many PHP objects to javascript with cppgc wrappers
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+ini_set('js.cppgc_wrappers', true);
+
+$context = new JS\Context();
+$context->assign('create', function($i) {
+    $object = new stdClass;
+    $object->id = $i;
+    return $object;
+});
+
+$start = microtime(true);
+$context->evaluate("let sum = 0; for (let i = 0; i < 200000; i++) sum += create(i).id; sum");
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
@@ -0,0 +1,20 @@
+<?php
+/**
+ *  Dispose.php
+ *
+ *  Benchmark for creating and disposing many contexts
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$start = microtime(true);
+for ($i = 0; $i < 1000; $i++)
+{
+    $context = new JS\Context();
+    $context->assign('tenant', ['id' => $i, 'data' => range(1, 1000)]);
+    $object = $context->evaluate("({ id: tenant.id, total: tenant.data.length })");
+    $context->dispose();
+}
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
+echo("memory: ".memory_get_usage()."\n");
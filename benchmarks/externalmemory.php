@@ -0,0 +1,19 @@
+<?php
+/**
+ *  Externalmemory.php
+ *
+ *  Benchmark for passing many large PHP arrays to javascript
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+$context->assign('load', function() {
+    return range(1, 10000);
+});
+
+$start = microtime(true);
+$context->evaluate("let sum = 0; for (let i = 0; i < 2000; i++) sum += load().length; sum");
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
+echo("peak memory: ".memory_get_peak_usage()."\n");
@@ -0,0 +1,23 @@
+<?php
+/**
+ *  Foreach.php
+ *
+ *  Benchmark for iterating over javascript objects and arrays with foreach
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+ini_set('js.lazy_arrays', true);
+
+$context = new JS\Context();
+
+$object = $context->evaluate("(function() { const o = {}; for (let i = 0; i < 200000; i++) o['key' + i] = i; return o; })()");
+$start = microtime(true);
+foreach ($object as $key => $value) {}
+echo("object elapsed: ".round(microtime(true) - $start, 3)."\n");
+
+$array = $context->evaluate("Array.from({ length: 1000000 }, (_, i) => i)");
+$start = microtime(true);
+foreach ($array as $key => $value) {}
+echo("array elapsed: ".round(microtime(true) - $start, 3)."\n");
@@ -0,0 +1,17 @@
+<?php
+/**
+ *  Generator.php
+ *
+ *  Benchmark for streaming a javascript generator into PHP
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+$start = microtime(true);
+$rows = $context->evaluate("(function*() { for (let i = 0; i < 1000000; i++) yield { id: i }; })()");
+foreach ($rows as $key => $row) {}
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
+echo("memory: ".memory_get_peak_usage()."\n");
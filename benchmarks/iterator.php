@@ -0,0 +1,23 @@
+<?php
+/**
+ *  Iterator.php
+ *
+ *  Benchmark for iterating over PHP arrays and generators in javascript
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+$context->evaluate("function sum(iterable) { var total = 0; for (var x of iterable) total += x; return total; }");
+
+$large = range(1, 100000);
+$context->assign('large', $large);
+
+$start = microtime(true);
+for ($i = 0; $i < 10; $i++) $context->evaluate("sum(large)");
+echo("array elapsed: ".round(microtime(true) - $start, 3)."\n");
+
+$start = microtime(true);
+for ($i = 0; $i < 10; $i++) { $context->assign('generator', (function() { for ($i = 0; $i < 100000; $i++) yield $i; })()); $context->evaluate("sum(generator)"); }
+echo("generator elapsed: ".round(microtime(true) - $start, 3)."\n");
@@ -0,0 +1,31 @@
+<?php
+/**
+ *  Json.php
+ *
+ *  Benchmark for passing a large document as array or as JSON
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$document = [];
+for ($i = 0; $i < 10000; $i++) $document[] = ['id' => $i, 'name' => "item $i", 'tags' => ['a', 'b'], 'price' => $i / 4];
+$json = json_encode($document);
+
+$context = new JS\Context();
+
+$start = microtime(true);
+for ($i = 0; $i < 100; $i++) $context->assign('document', $document);
+echo("assign elapsed: ".round(microtime(true) - $start, 3)."\n");
+
+$start = microtime(true);
+for ($i = 0; $i < 100; $i++) $context->assignJson('document', $json);
+echo("assignJson elapsed: ".round(microtime(true) - $start, 3)."\n");
+
+$start = microtime(true);
+for ($i = 0; $i < 100; $i++) $context->evaluate("document");
+echo("evaluate elapsed: ".round(microtime(true) - $start, 3)."\n");
+
+$start = microtime(true);
+for ($i = 0; $i < 100; $i++) json_decode($context->evaluate("document", 0, JS\AsJson), true);
+echo("evaluate as json elapsed: ".round(microtime(true) - $start, 3)."\n");
@@ -0,0 +1,17 @@
+<?php
+/**
+ *  Largestring.php
+ *
+ *  Benchmark for passing a large string to javascript
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$body = str_repeat("Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n", 100000);
+
+$context = new JS\Context();
+
+$start = microtime(true);
+for ($i = 0; $i < 100; $i++) $context->assign('body', $body);
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
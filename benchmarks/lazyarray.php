@@ -0,0 +1,18 @@
+<?php
+/**
+ *  LazyArray.php
+ *
+ *  Benchmark for returning a large javascript array to PHP
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+ini_set('js.lazy_arrays', true);
+
+$context = new JS\Context();
+
+$start = microtime(true);
+$result = $context->evaluate("Array.from({ length: 1000000 }, (_, i) => i)");
+$result[999999];
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
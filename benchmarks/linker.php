@@ -0,0 +1,21 @@
+<?php
+/**
+ *  Linker.php
+ *
+ *  Benchmark for reading the properties of linked PHP objects
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+$object = new stdClass;
+$object->x = 1;
+$object->y = 2;
+$context->assign('object', $object);
+$context->assign('list', [1, 2, 3]);
+
+$start = microtime(true);
+$context->evaluate("let sum = 0; for (let i = 0; i < 1000000; i++) sum += object.x + object.y + list[1]; sum");
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
@@ -0,0 +1,16 @@
+<?php
+/**
+ *  List.php
+ *
+ *  Benchmark for reading the elements of a PHP list in javascript
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+$context->assign('list', range(1, 1000000));
+
+$start = microtime(true);
+$context->evaluate("let sum = 0; for (let i = 0; i < list.length; i++) sum += list[i]; sum");
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
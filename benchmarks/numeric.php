@@ -0,0 +1,26 @@
+<?php
+/**
+ *  Numeric.php
+ *
+ *  Benchmark for passing lists of numbers as typed arrays
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$floats = [];
+for ($i = 0; $i < 100000; $i++) $floats[] = $i / 7;
+
+$context = new JS\Context();
+
+$start = microtime(true);
+for ($i = 0; $i < 100; $i++) $context->assignNumeric('floats', $floats);
+echo("assign elapsed: ".round(microtime(true) - $start, 3)."\n");
+
+$start = microtime(true);
+for ($i = 0; $i < 100; $i++) $context->evaluate("floats");
+echo("typed array elapsed: ".round(microtime(true) - $start, 3)."\n");
+
+$start = microtime(true);
+for ($i = 0; $i < 100; $i++) $context->evaluate("Array.from(floats)");
+echo("array elapsed: ".round(microtime(true) - $start, 3)."\n");
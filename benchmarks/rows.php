@@ -0,0 +1,15 @@
+<?php
+/**
+ *  Rows.php
+ *
+ *  Benchmark for converting an array of objects into rows
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+$start = microtime(true);
+$rows = $context->evaluate("Array.from({ length: 100000 }, (_, i) => ({ id: i, name: 'row' + i, active: i % 2 == 0 }))", 0, JS\AsRows);
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
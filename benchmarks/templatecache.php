@@ -0,0 +1,33 @@
+<?php
+/**
+ *  Templatecache.php
+ *
+ *  Benchmark for passing objects of a couple of classes to javascript
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+ini_set('js.template_cache', 4);
+
+class A { public $x = 1; }
+class B implements ArrayAccess {
+    public function offsetExists($offset): bool { return true; }
+    public function offsetGet($offset): mixed { return $offset; }
+    public function offsetSet($offset, $value): void {}
+    public function offsetUnset($offset): void {}
+}
+class C { public function __invoke() { return 'called'; } }
+
+$context = new JS\Context();
+$context->assign('create', function($i) {
+    switch ($i % 3) {
+    case 0: return new A;
+    case 1: return new B;
+    default: return new C;
+    }
+});
+
+$start = microtime(true);
+$context->evaluate("let n = 0; for (let i = 0; i < 100000; i++) { const o = create(i); n += (i % 3 == 0) ? o.x : (i % 3 == 1) ? o[1] : o().length; } n");
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
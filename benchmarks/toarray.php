@@ -0,0 +1,16 @@
+<?php
+/**
+ *  Toarray.php
+ *
+ *  Benchmark for plucking the properties of many javascript objects
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+$start = microtime(true);
+$rows = $context->evaluate("Array.from({ length: 100000 }, (_, i) => ({ id: i, name: 'row' + i }))");
+foreach ($rows as $row) $row->pluck(['id', 'name']);
+echo("elapsed: ".round(microtime(true) - $start, 3)."\n");
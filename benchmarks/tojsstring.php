@@ -0,0 +1,27 @@
+<?php
+/**
+ *  ToJsString.php
+ *
+ *  Benchmark for passing strings to javascript, with ascii, latin-1
+ *  and multibyte input
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$corpora = [
+    'ascii'     =>  str_repeat("The quick brown fox jumps over the lazy dog. ", 20),
+    'latin-1'   =>  str_repeat("Le coeur déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter. ", 15),
+    'multibyte' =>  str_repeat("日本語のテキストと English text が混在しています。", 20),
+];
+
+$context = new JS\Context();
+
+foreach ($corpora as $name => $string)
+{
+    $start = microtime(true);
+    for ($i = 0; $i < 100000; $i++) $context->assign('input', $string);
+    $elapsed = microtime(true) - $start;
+
+    echo(str_pad($name, 10).round(strlen($string) * 100000 / $elapsed / 1048576)." MB/s\n");
+}
@@ -0,0 +1,29 @@
+<?php
+/**
+ *  ToPhpString.php
+ *
+ *  Benchmark for strings that are returned from javascript, with ascii,
+ *  latin-1 and multibyte characters
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$corpora = [
+    'ascii'     =>  str_repeat("The quick brown fox jumps over the lazy dog. ", 50),
+    'latin-1'   =>  str_repeat("Le coeur déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter. ", 40),
+    'multibyte' =>  str_repeat("日本語のテキストと English text が混在しています。", 50),
+];
+
+$context = new JS\Context();
+
+foreach ($corpora as $name => $string)
+{
+    $context->assign('input', $string);
+
+    $start = microtime(true);
+    for ($i = 0; $i < 100000; $i++) $context->evaluate("input");
+    $elapsed = microtime(true) - $start;
+
+    echo(str_pad($name, 10).round(strlen($string) * 100000 / $elapsed / 1048576)." MB/s\n");
+}
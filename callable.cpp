@@ -0,0 +1,315 @@
+/**
+ *  Callable.cpp
+ *
+ *  Implementation file for the Callable class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "callable.h"
+#include "scope.h"
+#include "fromphp.h"
+#include "php_variable.h"
+#include "exception.h"
+#include <algorithm>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Functions that were garbage collected, and that still have to be deleted
+ *  @var std::vector<Callable*>
+ */
+std::vector<Callable *> Callable::_released;
+
+/**
+ *  Helper function to call a PHP callable with a fixed number of arguments,
+ *  this avoids that an intermediate PHP array has to be constructed
+ *  @param  callable    the callable to invoke
+ *  @param  arguments   the arguments to pass
+ *  @return Php::Value
+ */
+template <size_t ...Indices>
+static Php::Value execute(const Php::Value &callable, const std::vector<Php::Value> &arguments, std::index_sequence<Indices...>)
+{
+    // expand the arguments
+    return callable(arguments[Indices]...);
+}
+
+/**
+ *  Helper function to call a PHP callable
+ *  @param  callable    the callable to invoke
+ *  @param  arguments   the arguments to pass
+ *  @return Php::Value
+ */
+static Php::Value execute(const Php::Value &callable, const std::vector<Php::Value> &arguments)
+{
+    // the common cases are handled without building an array
+    switch (arguments.size()) {
+    case 0:     return execute(callable, arguments, std::make_index_sequence<0>());
+    case 1:     return execute(callable, arguments, std::make_index_sequence<1>());
+    case 2:     return execute(callable, arguments, std::make_index_sequence<2>());
+    case 3:     return execute(callable, arguments, std::make_index_sequence<3>());
+    case 4:     return execute(callable, arguments, std::make_index_sequence<4>());
+    case 5:     return execute(callable, arguments, std::make_index_sequence<5>());
+    case 6:     return execute(callable, arguments, std::make_index_sequence<6>());
+    default:    return Php::call("call_user_func_array", callable, Php::Array(arguments));
+    }
+}
+
+/**
+ *  Constructor
+ *  @param  isolate     the isolate
+ *  @param  context     the context in which the function is created
+ *  @param  callable    the PHP callable
+ *  @param  signature   array with the parameter types (or null to use reflection)
+ *  @throws Php::Exception
+ */
+Callable::Callable(v8::Isolate *isolate, const v8::Local<v8::Context> &context, const Php::Value &callable, const Php::Value &signature) :
+    Holder(isolate), _callable(callable)
+{
+    // this is a good moment to get rid of the functions that were garbage collected before
+    purge();
+
+    // if no signature was passed, we find out the parameters ourselves
+    if (!signature.isArray()) reflect(callable);
+
+    // otherwise we check the types that were passed
+    else for (auto &type : signature)
+    {
+        // look up the converter
+        auto *converter = Callable::converter(type.second);
+
+        // the type must be supported
+        if (converter == nullptr) throw Php::Exception("Unsupported parameter type '" + type.second.stringValue() + "'");
+
+        // remember the converter
+        _converters.push_back(converter);
+    }
+
+    // all parameters of an explicit signature are required
+    if (signature.isArray()) _required = _converters.size();
+
+    // create the function template, with ourselves passed as data and with the number of required parameters as arity
+    auto tpl = v8::FunctionTemplate::New(isolate, &Callable::invoke, v8::External::New(isolate, this), v8::Local<v8::Signature>(), _required, v8::ConstructorBehavior::kThrow);
+
+    // turn it into a function
+    v8::Local<v8::Function> function;
+    if (!tpl->GetFunction(context).ToLocal(&function)) throw Php::Exception("Unable to create function");
+
+    // we want to be notified when the function is garbage collected
+    _function.Reset(isolate, function);
+
+    // install a function that will be called when the object is garbage collected
+    _function.SetWeak<Callable>(this, [](const v8::WeakCallbackInfo<Callable> &info) {
+
+        // the handle must be reset right away, the object itself is deleted later
+        info.GetParameter()->_function.Reset();
+
+        // queue the object
+        _released.push_back(info.GetParameter());
+
+    }, v8::WeakCallbackType::kParameter);
+}
+
+/**
+ *  Delete the functions that were garbage collected
+ */
+void Callable::purge()
+{
+    // take over the functions (destructing a PHP callable could create new functions)
+    std::vector<Callable *> released;
+    released.swap(_released);
+
+    // delete them
+    for (auto *callable : released) delete callable;
+}
+
+/**
+ *  Destructor
+ */
+Callable::~Callable()
+{
+    // forget the handle
+    _function.Reset();
+}
+
+/**
+ *  Helper method to find the converter for a certain type
+ *  @param  type        name of the type (int, float, string, bool or mixed)
+ *  @return Converter   nullptr for unsupported types
+ */
+Callable::Converter Callable::converter(const Php::Value &type)
+{
+    // we need the name of the type
+    auto name = type.stringValue();
+
+    // check the supported types
+    if (name == "int")      return &Callable::toInteger;
+    if (name == "float")    return &Callable::toFloat;
+    if (name == "string")   return &Callable::toString;
+    if (name == "bool")     return &Callable::toBool;
+    if (name == "mixed")    return &Callable::toMixed;
+
+    // not supported
+    return nullptr;
+}
+
+/**
+ *  Helper method to derive the converters from the reflection information
+ *  @param  callable    the callable to inspect
+ */
+void Callable::reflect(const Php::Value &callable)
+{
+    // turning the callable into a closure gives us reflection for all sorts of callables
+    Php::Object reflection("ReflectionFunction", Php::call("Closure::fromCallable", callable));
+
+    // inspect all parameters
+    for (auto &parameter : reflection.call("getParameters"))
+    {
+        // variadic parameters are not part of the arity
+        if (parameter.second.call("isVariadic")) break;
+
+        // the parameters before the first optional one are required
+        if (_required == _converters.size() && !parameter.second.call("isOptional")) ++_required;
+
+        // the declared type
+        Php::Value type = parameter.second.call("getType");
+
+        // only builtin types that do not allow null get a specialized converter
+        bool builtin = type.instanceOf("ReflectionNamedType") && type.call("isBuiltin") && !type.call("allowsNull");
+
+        // look up the converter
+        auto *converter = builtin ? Callable::converter(type.call("getName")) : nullptr;
+
+        // use it, or fall back to the generic conversion
+        _converters.push_back(converter ? converter : &Callable::toMixed);
+    }
+}
+
+/**
+ *  Convert to an integer
+ *  @param  isolate     the isolate
+ *  @param  value       the javascript value to convert
+ *  @return Php::Value
+ */
+Php::Value Callable::toInteger(v8::Isolate *isolate, const v8::Local<v8::Value> &value)
+{
+    // the common case
+    if (value->IsInt32()) return value.As<v8::Int32>()->Value();
+
+    // do the full conversion
+    return value->IntegerValue(isolate->GetCurrentContext()).FromMaybe(0);
+}
+
+/**
+ *  Convert to a floating point number
+ *  @param  isolate     the isolate
+ *  @param  value       the javascript value to convert
+ *  @return Php::Value
+ */
+Php::Value Callable::toFloat(v8::Isolate *isolate, const v8::Local<v8::Value> &value)
+{
+    // the common case
+    if (value->IsNumber()) return value.As<v8::Number>()->Value();
+
+    // do the full conversion
+    return value->NumberValue(isolate->GetCurrentContext()).FromMaybe(0.0);
+}
+
+/**
+ *  Convert to a string
+ *  @param  isolate     the isolate
+ *  @param  value       the javascript value to convert
+ *  @return Php::Value
+ */
+Php::Value Callable::toString(v8::Isolate *isolate, const v8::Local<v8::Value> &value)
+{
+    // the common case
+    if (value->IsString()) return PhpVariable(isolate, value);
+
+    // do the full conversion
+    v8::Local<v8::String> string;
+    if (!value->ToString(isolate->GetCurrentContext()).ToLocal(&string)) return "";
+
+    // convert the string
+    return PhpVariable(isolate, string);
+}
+
+/**
+ *  Convert to a boolean
+ *  @param  isolate     the isolate
+ *  @param  value       the javascript value to convert
+ *  @return Php::Value
+ */
+Php::Value Callable::toBool(v8::Isolate *isolate, const v8::Local<v8::Value> &value)
+{
+    // this conversion cannot fail
+    return value->BooleanValue(isolate);
+}
+
+/**
+ *  Convert a value of any type
+ *  @param  isolate     the isolate
+ *  @param  value       the javascript value to convert
+ *  @return Php::Value
+ */
+Php::Value Callable::toMixed(v8::Isolate *isolate, const v8::Local<v8::Value> &value)
+{
+    // use the generic conversion
+    return PhpVariable(isolate, value);
+}
+
+/**
+ *  Method that is called when the function is invoked from javascript
+ *  @param  info        callback info
+ */
+void Callable::invoke(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    // we need the isolate
+    auto *isolate = info.GetIsolate();
+
+    // create handle-scope
+    Scope scope(isolate);
+
+    // the object that was passed when the function was created
+    auto *self = static_cast<Callable *>(info.Data().As<v8::External>()->Value());
+
+    // number of declared and required parameters
+    size_t declared = self->_converters.size();
+    size_t required = self->_required;
+
+    // avoid exceptions
+    try
+    {
+        // missing required arguments are passed as undefined, just like a javascript function with this
+        // arity would get them, missing optional arguments are left out so that PHP uses the default values
+        size_t count = std::max<size_t>(info.Length(), required);
+
+        // the arguments to pass to PHP space
+        std::vector<Php::Value> arguments;
+        arguments.reserve(count);
+
+        // convert the arguments (info[i] is undefined beyond the passed arguments), additional arguments get the generic conversion
+        for (size_t i = 0; i < count; ++i) arguments.push_back((i < declared ? self->_converters[i] : &Callable::toMixed)(isolate, info[int(i)]));
+
+        // call the function and store the return value
+        info.GetReturnValue().Set(FromPhp(isolate, execute(self->_callable, arguments)));
+    }
+    catch (const Php::Exception &exception)
+    {
+        // pass the exception on to javascript userspace
+        isolate->ThrowException(Exception(isolate, exception));
+    }
+}
+
+/**
+ *  End of namespace
+ */
+}
@@ -0,0 +1,154 @@
+/**
+ *  Callable.h
+ *
+ *  Class that exposes a PHP callable to javascript as a real function
+ *  object with a fixed signature. The converters for the parameters are
+ *  selected once (when the function is registered), so that calls from
+ *  javascript do not have to inspect the type of each argument.
+ *
+ *  The object is self-destructing: it is destructed when the javascript
+ *  function is garbage collected.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+#include <vector>
+#include "holder.h"
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class Callable : public Holder
+{
+private:
+    /**
+     *  Signature of a function that converts a javascript argument to PHP
+     *  @var    Converter
+     */
+    using Converter = Php::Value (*)(v8::Isolate *isolate, const v8::Local<v8::Value> &value);
+
+    /**
+     *  The function object, this is a weak reference so that we are notified
+     *  when the function is garbage collected
+     *  @var v8::Global<v8::Function>
+     */
+    v8::Global<v8::Function> _function;
+
+    /**
+     *  The PHP callable that is invoked
+     *  @var Php::Value
+     */
+    Php::Value _callable;
+
+    /**
+     *  The converters for each of the declared parameters
+     *  @var std::vector<Converter>
+     */
+    std::vector<Converter> _converters;
+
+    /**
+     *  Number of required parameters (the arity of the function), missing optional
+     *  arguments are not passed, so that PHP uses the default values
+     *  @var size_t
+     */
+    size_t _required = 0;
+
+    /**
+     *  Functions that were garbage collected, they are deleted later because
+     *  destructing the PHP callable is not allowed during a garbage collection
+     *  @var std::vector<Callable*>
+     */
+    static std::vector<Callable *> _released;
+
+    /**
+     *  Helper method to find the converter for a certain type
+     *  @param  type        name of the type (int, float, string, bool or mixed)
+     *  @return Converter
+     *  @throws Php::Exception
+     */
+    static Converter converter(const Php::Value &type);
+
+    /**
+     *  Helper method to derive the converters from the reflection information
+     *  @param  callable    the callable to inspect
+     */
+    void reflect(const Php::Value &callable);
+
+    /**
+     *  The specialized converters
+     *  @param  isolate     the isolate
+     *  @param  value       the javascript value to convert
+     *  @return Php::Value
+     */
+    static Php::Value toInteger(v8::Isolate *isolate, const v8::Local<v8::Value> &value);
+    static Php::Value toFloat(v8::Isolate *isolate, const v8::Local<v8::Value> &value);
+    static Php::Value toString(v8::Isolate *isolate, const v8::Local<v8::Value> &value);
+    static Php::Value toBool(v8::Isolate *isolate, const v8::Local<v8::Value> &value);
+    static Php::Value toMixed(v8::Isolate *isolate, const v8::Local<v8::Value> &value);
+
+    /**
+     *  Method that is called when the function is invoked from javascript
+     *  @param  info        callback info
+     */
+    static void invoke(const v8::FunctionCallbackInfo<v8::Value> &info);
+
+public:
+    /**
+     *  Constructor
+     *  @param  isolate     the isolate
+     *  @param  context     the context in which the function is created
+     *  @param  callable    the PHP callable
+     *  @param  signature   array with the parameter types (or null to use reflection)
+     *  @throws Php::Exception
+     */
+    Callable(v8::Isolate *isolate, const v8::Local<v8::Context> &context, const Php::Value &callable, const Php::Value &signature);
+
+    /**
+     *  No copying
+     *  @param  that
+     */
+    Callable(const Callable &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~Callable();
+
+    /**
+     *  Release the PHP callable (when the context is disposed)
+     */
+    virtual void release() override { _callable = nullptr; }
+
+    /**
+     *  Delete the functions that were garbage collected
+     */
+    static void purge();
+
+    /**
+     *  Get the function-handle
+     *  @param  isolate
+     *  @return v8::Local<v8::Function>
+     */
+    v8::Local<v8::Function> handle(v8::Isolate *isolate) const { return _function.Get(isolate); }
+};
+
+/**
+ *  End of namespace
+ */
+}
@@ -0,0 +1,151 @@
+/**
+ *  Conversion.h
+ *
+ *  The policy that decides how PHP arrays and objects are converted into
+ *  javascript: they are either wrapped in a proxy (which is cheap to create,
+ *  but every access crosses into PHP), or deep copied into native javascript
+ *  arrays and objects (which are more expensive to create, but much faster
+ *  to access from javascript). In automatic mode, values are only copied
+ *  when they are small enough.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <algorithm>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class Conversion
+{
+public:
+    /**
+     *  The supported modes
+     */
+    enum Mode {
+        Proxy   =   0,
+        Copy    =   1,
+        Auto    =   2
+    };
+
+private:
+    /**
+     *  The mode
+     *  @var Mode
+     */
+    Mode _mode = Proxy;
+
+    /**
+     *  Max number of elements (in total, including nested elements) that are copied in automatic mode
+     *  @var size_t
+     */
+    size_t _maxsize = 256;
+
+    /**
+     *  Max nesting depth that is copied (deeper values are proxied)
+     *  @var size_t
+     */
+    size_t _maxdepth = 8;
+
+    /**
+     *  Helper method to convert a PHP value to a mode
+     *  @param  value
+     *  @return Mode
+     *  @throws Php::Exception
+     */
+    static Mode mode(const Php::Value &value)
+    {
+        // check the value
+        switch (value.numericValue()) {
+        case Proxy: return Proxy;
+        case Copy:  return Copy;
+        case Auto:  return Auto;
+        default:    throw Php::Exception("Invalid conversion mode, use JS\\Proxy, JS\\Copy or JS\\Auto");
+        }
+    }
+
+public:
+    /**
+     *  Default constructor
+     */
+    Conversion() = default;
+
+    /**
+     *  Constructor
+     *  @param  mode        the mode
+     *  @param  maxsize     max number of elements to copy (or null to use the default)
+     *  @param  maxdepth    max depth to copy (or null to use the default)
+     *  @throws Php::Exception
+     */
+    Conversion(const Php::Value &mode, const Php::Value &maxsize, const Php::Value &maxdepth) : _mode(Conversion::mode(mode))
+    {
+        // overwrite the thresholds
+        if (!maxsize.isNull()) _maxsize = std::max<int64_t>(maxsize.numericValue(), 0);
+        if (!maxdepth.isNull()) _maxdepth = std::max<int64_t>(maxdepth.numericValue(), 0);
+    }
+
+    /**
+     *  Constructor that copies the thresholds from a different policy, with a different mode
+     *  @param  that        the other policy
+     *  @param  mode        the mode
+     *  @throws Php::Exception
+     */
+    Conversion(const Conversion &that, const Php::Value &mode) :
+        _mode(Conversion::mode(mode)), _maxsize(that._maxsize), _maxdepth(that._maxdepth) {}
+
+    /**
+     *  Copy constructor
+     *  @param  that
+     */
+    Conversion(const Conversion &that) = default;
+
+    /**
+     *  Destructor
+     */
+    virtual ~Conversion() = default;
+
+    /**
+     *  Assignment
+     *  @param  that
+     *  @return Conversion
+     */
+    Conversion &operator=(const Conversion &that) = default;
+
+    /**
+     *  The mode
+     *  @return Mode
+     */
+    Mode mode() const { return _mode; }
+
+    /**
+     *  Max number of elements to copy
+     *  @return size_t
+     */
+    size_t maxsize() const { return _maxsize; }
+
+    /**
+     *  Max depth to copy
+     *  @return size_t
+     */
+    size_t maxdepth() const { return _maxdepth; }
+};
+
+/**
+ *  End of namespace
+ */
+}
@@ -19,6 +19,14 @@
 #include "script.h"
 #include "names.h"
 #include "linker.h"
+#include "link.h"
+#include "wrapper.h"
+#include "callable.h"
+#include "zendvalue.h"
+#include "interned.h"
+#include "fromphpcopy.h"
+#include "php_buffer.h"
+#include "numeric.h"
 
 /**
  *  Begin of namespace
@@ -75,6 +83,15 @@ Core::Core(const Php::Value &root) : _isolate(this)
     _context.Reset(_isolate, context);
 }
 
+/**
+ *  Destructor
+ */
+Core::~Core()
+{
+    // the objects that were created in this context may outlive it, so we release them now
+    dispose();
+}
+
 /**
  *  Given an isolate, it is possible to upgrade to the full context
  *  @return std::shared_ptr
@@ -105,8 +122,267 @@ v8::Local<v8::Value> Core::wrap(const Php::Value &object)
     // was this possible? then we reuse the original handle
     if (instance != nullptr) return instance->handle();
     
+    // binary data is passed as a new array of bytes
+    auto *buffer = PhpBuffer::unwrap(object);
+    if (buffer != nullptr) return buffer->handle(_isolate);
+    
+    // arrays have no identity, they always get a new wrapper
+    if (!object.isObject()) return _isolate.prototype(object).apply(object);
+    
+    // the handle that uniquely identifies the object (while it is alive)
+    uint32_t handle = Z_OBJ_HANDLE_P(ZendValue::get(object));
+    
+    // do we already have a wrapper for this object that was not yet garbage collected?
+    auto iter = _wrappers.find(handle);
+    if (iter != _wrappers.end() && !iter->second.IsEmpty()) return iter->second.Get(_isolate);
+    
     // check the prototypes that we have
-    return _isolate.prototype(object).apply(object);
+    auto result = _isolate.prototype(object).apply(object);
+    
+    // if no object could be constructed
+    if (!result->IsObject()) return result;
+    
+    // time to clean up the map?
+    if (_wrappers.size() >= _sweep) sweep();
+    
+    // remember the wrapper, the handle is weak so it does not keep the wrapper alive (note
+    // that the wrapper itself keeps the PHP object alive, so the handle cannot be reused
+    // for a different object for as long as the wrapper exists)
+    auto &wrapper = _wrappers[handle];
+    wrapper.Reset(_isolate, result.As<v8::Object>());
+    wrapper.SetWeak();
+    
+    // expose the wrapper
+    return result;
+}
+
+/**
+ *  Convert a PHP array or object into javascript, using a specific policy
+ *  @param  value       MUST be an array or object!
+ *  @param  conversion  the policy
+ *  @return v8::Local<v8::Value>
+ */
+v8::Local<v8::Value> Core::convert(const Php::Value &value, const Conversion &conversion)
+{
+    // should the value be proxied?
+    if (conversion.mode() == Conversion::Proxy || !FromPhpCopy::copyable(value)) return ++_proxied, wrap(value);
+    
+    // try to copy the value
+    v8::Local<v8::Value> result;
+    if (FromPhpCopy(this, conversion).value(value).ToLocal(&result)) return ++_copied, result;
+    
+    // the value was too big to copy, so we fall back to a proxy
+    ++_fallbacks; ++_proxied;
+    
+    // wrap the value
+    return wrap(value);
+}
+
+/**
+ *  Statistics about this context
+ *  @return Php::Value
+ */
+Php::Value Core::statistics() const
+{
+    // the result
+    Php::Array result;
+    
+    // the conversion counters
+    result["proxied"] = int64_t(_proxied);
+    result["copied"] = int64_t(_copied);
+    result["fallbacks"] = int64_t(_fallbacks);
+    
+    // the number of javascript objects that are linked to a PHP value
+    result["links"] = int64_t(Link::live());
+    result["wrappers"] = int64_t(Wrapper::live());
+    
+    // the cache of templates per class
+    result["templates"] = int64_t(TemplateCache::size());
+    result["template_hits"] = int64_t(TemplateCache::hits());
+    result["template_misses"] = int64_t(TemplateCache::misses());
+    result["template_evictions"] = int64_t(TemplateCache::evictions());
+    
+    // the memory of the array buffers
+    result["buffer_bytes"] = int64_t(Allocator::live());
+    result["buffer_peak"] = int64_t(Allocator::peak());
+    
+    // expose the result
+    return result;
+}
+
+/**
+ *  Release the context and everything that is linked to it right away
+ */
+void Core::dispose()
+{
+    // already disposed
+    if (_context.IsEmpty()) return;
+
+    // we need a scope to access the objects
+    v8::Isolate::Scope iscope(_isolate);
+    v8::HandleScope hscope(_isolate);
+
+    // the context to dispose
+    v8::Local<v8::Context> context(_context.Get(_isolate));
+    v8::Context::Scope cscope(context);
+
+    // the PHP objects that wrap javascript values become inert (they throw when they are used)
+    for (auto *object : _objects) object->detach();
+
+    // forget them
+    _objects.clear();
+
+    // release the PHP objects that were wrapped for javascript
+    for (auto &[handle, wrapper] : _wrappers)
+    {
+        // skip the wrappers that were already garbage collected
+        if (!wrapper.IsEmpty()) Linker(_isolate, wrapper.Get(_isolate)).detach();
+    }
+
+    // forget the wrappers
+    _wrappers.clear();
+
+    // release the root object
+    Linker(_isolate, context->Global()).detach();
+
+    // release the PHP variables that are still referred to by javascript (one at a time,
+    // because destructing a variable could run PHP code that removes other holders)
+    while (_holders != nullptr)
+    {
+        // take the first holder out of the list
+        Holder *holder = _holders;
+        remove(holder);
+
+        // release its variable
+        holder->release();
+    }
+
+    // forget the prototypes of the iterators
+    _arrayiterator.Reset();
+    _stringiterator.Reset();
+
+    // forget the context
+    _context.Reset();
+
+    // let v8 know that the memory of the context can be reclaimed
+    isolate()->ContextDisposedNotification();
+}
+
+/**
+ *  Helper function to get the prototype of the iterator that is returned by a method
+ *  @param  context     the current context
+ *  @param  method      the method that returns the iterator
+ *  @param  object      the object on which the method is called
+ *  @return v8::Local<v8::Value>    empty when something goes wrong
+ */
+static v8::Local<v8::Value> prototype(const v8::Local<v8::Context> &context, const v8::Local<v8::Value> &method, const v8::Local<v8::Value> &object)
+{
+    // the method must be a function
+    if (!method->IsFunction()) return v8::Local<v8::Value>();
+
+    // create an iterator
+    v8::Local<v8::Value> iterator;
+    if (!method.As<v8::Function>()->Call(context, object, 0, nullptr).ToLocal(&iterator) || !iterator->IsObject()) return v8::Local<v8::Value>();
+
+    // expose its prototype
+    return iterator.As<v8::Object>()->GetPrototypeV2();
+}
+
+/**
+ *  Is a prototype the prototype of the builtin iterators of arrays or strings?
+ *  @param  prototype   the prototype of an object
+ *  @return bool
+ */
+bool Core::iterator(const v8::Local<v8::Value> &prototype)
+{
+    // only objects can be prototypes
+    if (!prototype->IsObject()) return false;
+
+    // look up the prototypes the first time
+    if (_arrayiterator.IsEmpty())
+    {
+        // the current context
+        auto context = isolate()->GetCurrentContext();
+
+        // nothing that goes wrong here should leak to javascript
+        v8::TryCatch catcher(_isolate);
+
+        // the original Array.prototype.values is available as intrinsic, so scripts cannot replace it
+        auto name = v8::String::NewFromUtf8Literal(_isolate, "values");
+        auto tpl = v8::ObjectTemplate::New(_isolate);
+        tpl->SetIntrinsicDataProperty(name, v8::kArrayProto_values);
+
+        // get the method
+        v8::Local<v8::Object> holder;
+        v8::Local<v8::Value> values;
+        if (tpl->NewInstance(context).ToLocal(&holder) && holder->Get(context, name).ToLocal(&values))
+        {
+            // the prototype of an array iterator
+            auto result = JS::prototype(context, values, v8::Array::New(_isolate));
+            if (!result.IsEmpty()) _arrayiterator.Reset(_isolate, result);
+        }
+
+        // there is no intrinsic for strings, so we use String.prototype[Symbol.iterator]
+        auto string = v8::StringObject::New(_isolate, v8::String::Empty(_isolate)).As<v8::Object>();
+        v8::Local<v8::Value> method;
+        if (string->Get(context, v8::Symbol::GetIterator(_isolate)).ToLocal(&method))
+        {
+            // the prototype of a string iterator
+            auto result = JS::prototype(context, method, string);
+            if (!result.IsEmpty()) _stringiterator.Reset(_isolate, result);
+        }
+
+        // if the lookup failed, we use a placeholder so that it is not tried over and over again
+        if (_arrayiterator.IsEmpty()) _arrayiterator.Reset(_isolate, v8::Null(_isolate));
+    }
+
+    // compare the prototypes
+    if (prototype->StrictEquals(_arrayiterator.Get(_isolate))) return true;
+    return !_stringiterator.IsEmpty() && prototype->StrictEquals(_stringiterator.Get(_isolate));
+}
+
+/**
+ *  Register an object that keeps a PHP variable alive on behalf of javascript
+ *  @param  holder
+ */
+void Core::add(Holder *holder)
+{
+    // add the holder to the front of the list
+    holder->_core = this;
+    holder->_prev = nullptr;
+    holder->_next = _holders;
+
+    // link the old front to the holder
+    if (_holders != nullptr) _holders->_prev = holder;
+    _holders = holder;
+}
+
+/**
+ *  Unregister an object that keeps a PHP variable alive on behalf of javascript
+ *  @param  holder
+ */
+void Core::remove(Holder *holder)
+{
+    // link the neighbours to each other
+    if (holder->_prev != nullptr) holder->_prev->_next = holder->_next;
+    else _holders = holder->_next;
+    if (holder->_next != nullptr) holder->_next->_prev = holder->_prev;
+
+    // the holder is no longer registered
+    holder->_core = nullptr;
+    holder->_prev = holder->_next = nullptr;
+}
+
+/**
+ *  Remove the wrappers that have been garbage collected
+ */
+void Core::sweep()
+{
+    // remove the empty handles
+    std::erase_if(_wrappers, [](const auto &item) { return item.second.IsEmpty(); });
+    
+    // next sweep when the map has grown twice as big
+    _sweep = std::max(size_t(1024), _wrappers.size() * 2);
 }
 
 /**
@@ -114,9 +390,11 @@ v8::Local<v8::Value> Core::wrap(const Php::Value &object)
  *  @param  name        name of property to assign  required
  *  @param  value       value to be assigned
  *  @param  attribytes  property attributes
+ *  @param  mode        conversion mode, or null to use the policy of the context
  *  @return bool
+ *  @throws Php::Exception
  */
-bool Core::assign(const Php::Value &name, const Php::Value &value, const Php::Value &attributes)
+bool Core::assign(const Php::Value &name, const Php::Value &value, const Php::Value &attributes, const Php::Value &mode)
 {
     // avoid that other contexts are assigned
     if (value.instanceOf(Names::Context) || value.instanceOf(Names::Script)) return false;
@@ -131,28 +409,130 @@ bool Core::assign(const Php::Value &name, const Php::Value &value, const Php::Va
     auto attribute = attributes.isNull() ? v8::None : static_cast<v8::PropertyAttribute>(attributes.numericValue());
     
     // convert the property to a javascript name
-    v8::Local<v8::Value> property = FromPhp(_isolate, name.clone(Php::Type::String));
+    v8::Local<v8::String> property = Interned::js(_isolate, name);
+
+    // convert the value, arrays and objects may use a different policy than the context
+    v8::Local<v8::Value> converted = mode.isNull() || (!value.isArray() && !value.isObject()) ? FromPhp(_isolate, value) : convert(value, Conversion(_conversion, mode));
 
     // store the value
-    v8::Maybe<bool> result = global->DefineOwnProperty(scope, property.As<v8::String>(), FromPhp(_isolate, value), attribute);
+    v8::Maybe<bool> result = global->DefineOwnProperty(scope, property, converted, attribute);
     
     // check for success
     return result.IsJust() && result.FromJust();
 }
 
+/**
+ *  Assign a PHP callable to the javascript context as a real function
+ *  @param  name        name of the function
+ *  @param  callable    the PHP callable
+ *  @param  signature   array with parameter types, or null to use reflection
+ *  @return bool
+ *  @throws Php::Exception
+ */
+bool Core::assignFunction(const Php::Value &name, const Php::Value &callable, const Php::Value &signature)
+{
+    // scope for the context
+    Scope scope(shared_from_this());
+
+    // convert the property to a javascript name
+    v8::Local<v8::String> property = Interned::js(_isolate, name);
+
+    // create the function (the object is destructed when the function is garbage collected)
+    auto *function = new Callable(_isolate, scope, callable, signature);
+
+    // get the function handle
+    auto handle = function->handle(_isolate);
+
+    // the function is named after the property
+    handle->SetName(property);
+
+    // store the function
+    v8::Maybe<bool> result = scope.global()->DefineOwnProperty(scope, property, handle, v8::None);
+
+    // check for success
+    return result.IsJust() && result.FromJust();
+}
+
+/**
+ *  Assign a list of numbers to the javascript context as a typed array
+ *  @param  name        name of the property
+ *  @param  list        the PHP array with numbers
+ *  @param  type        the type of the typed array (JS\Float64 or JS\Int32), or null for JS\Float64
+ *  @return bool
+ *  @throws Php::Exception
+ */
+bool Core::assignNumeric(const Php::Value &name, const Php::Value &list, const Php::Value &type)
+{
+    // scope for the context
+    Scope scope(shared_from_this());
+
+    // convert the property to a javascript name
+    v8::Local<v8::String> property = Interned::js(_isolate, name);
+
+    // create the typed array
+    v8::Local<v8::Value> array = Numeric::create(_isolate, list, type);
+
+    // store the array
+    v8::Maybe<bool> result = scope.global()->DefineOwnProperty(scope, property, array, v8::None);
+
+    // check for success
+    return result.IsJust() && result.FromJust();
+}
+
+/**
+ *  Assign a JSON document to the javascript context, parsed by v8
+ *  @param  name        name of the property
+ *  @param  json        the JSON document
+ *  @return bool
+ *  @throws Php::Exception
+ */
+bool Core::assignJson(const Php::Value &name, const Php::Value &json)
+{
+    // scope for the context
+    Scope scope(shared_from_this());
+
+    // convert the property to a javascript name
+    v8::Local<v8::String> property = Interned::js(_isolate, name);
+
+    // the document must be a string (PHP does not enforce the parameter type)
+    if (!json.isString()) throw Php::Exception("JSON document must be passed as string");
+
+    // for catching syntax errors
+    v8::TryCatch catcher(_isolate);
+
+    // parse the document (large documents are shared with PHP instead of copied)
+    v8::Local<v8::Value> parsed;
+    if (!v8::JSON::Parse(scope, FromPhp(_isolate, json).As<v8::String>()).ToLocal(&parsed))
+    {
+        // there may not be a message if the error was not thrown by the parser
+        if (catcher.Message().IsEmpty()) throw Php::Exception("Invalid JSON");
+
+        // pass the exception on to PHP userspace
+        throw PhpException(_isolate, catcher);
+    }
+
+    // store the value
+    v8::Maybe<bool> result = scope.global()->DefineOwnProperty(scope, property, parsed, v8::None);
+
+    // check for success
+    return result.IsJust() && result.FromJust();
+}
+
 /**
  *  Parse a piece of javascript code
  *  @param  source      the code to execute
+ *  @param  timeout     possible timeout in seconds
+ *  @param  flags       bitmask of flags for converting the result
  *  @return Php::Value
  *  @throws Php::Exception
  */
-Php::Value Core::evaluate(const Php::Value &source, const Php::Value &timeout)
+Php::Value Core::evaluate(const Php::Value &source, const Php::Value &timeout, const Php::Value &flags)
 {
     // create a script
     Script script(shared_from_this(), source.clone(Php::Type::String).rawValue());
     
     // evaluate the script
-    return script.execute(shared_from_this(), timeout);
+    return script.execute(shared_from_this(), timeout, flags);
 }
     
 /**
@@ -16,13 +16,22 @@
  *  Dependencies
  */
 #include <phpcpp.h>
+#include <unordered_map>
+#include <unordered_set>
 #include "isolate.h"
+#include "conversion.h"
+#include "holder.h"
 
 /**
  *  Start namespace
  */
 namespace JS {
 
+/**
+ *  Forward declarations
+ */
+class PhpBase;
+
 /**
  *  Class definition
  */
@@ -41,6 +50,84 @@ private:
      *  @var v8::Global<v8::Context>
      */
     v8::Global<v8::Context> _context;
+
+    /**
+     *  The javascript wrappers of PHP objects, indexed by the object handle, so that
+     *  the same PHP object always turns into the same javascript object. These are
+     *  weak handles that are reset by v8 when the wrapper is garbage collected.
+     *  @var std::unordered_map<uint32_t, v8::Global<v8::Object>>
+     */
+    std::unordered_map<uint32_t, v8::Global<v8::Object>> _wrappers;
+
+    /**
+     *  The JS\Object instances (and the other PHP objects that wrap a javascript value)
+     *  that belong to this context, they are made inert when the context is disposed
+     *  @var std::unordered_set<PhpBase*>
+     */
+    std::unordered_set<PhpBase *> _objects;
+
+    /**
+     *  The objects that keep a PHP variable alive on behalf of javascript (links, wrappers,
+     *  functions and iterators), in a linked list, the variables are released when the
+     *  context is disposed
+     *  @var Holder
+     */
+    Holder *_holders = nullptr;
+
+    /**
+     *  Size of the wrapper map at which we remove the handles that were garbage collected
+     *  @var size_t
+     */
+    size_t _sweep = 1024;
+
+    /**
+     *  The policy for converting PHP arrays and objects into javascript
+     *  @var Conversion
+     */
+    Conversion _conversion;
+
+    /**
+     *  Are javascript arrays exposed as JS\Array objects (the "js.lazy_arrays" setting
+     *  is read once when the context is created, and not for every conversion)
+     *  @var bool
+     */
+    bool _lazy = Php::ini_get("js.lazy_arrays");
+
+    /**
+     *  The number of bytes per array element or object property that is reported to v8 as
+     *  external memory (the "js.external_memory_factor" setting, read once per context)
+     *  @var int64_t
+     */
+    int64_t _factor = Php::ini_get("js.external_memory_factor").numericValue();
+
+    /**
+     *  The minimum size of PHP strings that are shared with javascript instead of copied
+     *  (the "js.external_strings" setting, read once per context, zero to disable)
+     *  @var size_t
+     */
+    size_t _external = Php::ini_get("js.external_strings").numericValue();
+
+    /**
+     *  The prototypes of the iterators of arrays and strings (%ArrayIteratorPrototype% and
+     *  %StringIteratorPrototype%), they are looked up the first time they are needed
+     *  @var v8::Global<v8::Value>
+     */
+    v8::Global<v8::Value> _arrayiterator;
+    v8::Global<v8::Value> _stringiterator;
+
+    /**
+     *  Counters for the conversions: values that were proxied, values that were
+     *  copied, and values that were too big to copy in automatic mode
+     *  @var size_t
+     */
+    size_t _proxied = 0;
+    size_t _copied = 0;
+    size_t _fallbacks = 0;
+
+    /**
+     *  Remove the wrappers that have been garbage collected
+     */
+    void sweep();
     
 public:
     /**
@@ -63,7 +150,7 @@ public:
     /**
      *  Destructor
      */
-    virtual ~Core() = default;
+    virtual ~Core();
 
     /**
      *  Given an isolate, it is possible to upgrade to the full context
@@ -83,6 +170,58 @@ public:
      *  @return v8::Local<v8::Value>
      */
     v8::Local<v8::Value> wrap(const Php::Value &object);
+
+    /**
+     *  Convert a PHP array or object into javascript, using the policy of the context
+     *  @param  value       MUST be an array or object!
+     *  @return v8::Local<v8::Value>
+     */
+    v8::Local<v8::Value> convert(const Php::Value &value) { return convert(value, _conversion); }
+
+    /**
+     *  Convert a PHP array or object into javascript, using a specific policy
+     *  @param  value       MUST be an array or object!
+     *  @param  conversion  the policy
+     *  @return v8::Local<v8::Value>
+     */
+    v8::Local<v8::Value> convert(const Php::Value &value, const Conversion &conversion);
+
+    /**
+     *  Change the conversion policy
+     *  @param  conversion  the new policy
+     */
+    void conversion(const Conversion &conversion) { _conversion = conversion; }
+
+    /**
+     *  Are javascript arrays exposed as JS\Array objects?
+     *  @return bool
+     */
+    bool lazy() const { return _lazy; }
+
+    /**
+     *  The number of bytes per array element or object property that is reported as external memory
+     *  @return int64_t
+     */
+    int64_t factor() const { return _factor; }
+
+    /**
+     *  The minimum size of strings that are shared with javascript (zero if disabled)
+     *  @return size_t
+     */
+    size_t external() const { return _external; }
+
+    /**
+     *  Is a prototype the prototype of the builtin iterators of arrays or strings?
+     *  @param  prototype   the prototype of an object
+     *  @return bool
+     */
+    bool iterator(const v8::Local<v8::Value> &prototype);
+
+    /**
+     *  Statistics about this context
+     *  @return Php::Value
+     */
+    Php::Value statistics() const;
     
     /**
      *  Expose the context
@@ -90,25 +229,99 @@ public:
      *  @param  scope
      *  @return v8::Local<v8::Context>
      */
-    v8::Local<v8::Context> context(const v8::HandleScope &scope) { return _context.Get(_isolate); }
+    v8::Local<v8::Context> context(const v8::HandleScope &scope)
+    {
+        // a context that was disposed can no longer be used
+        if (_context.IsEmpty()) throw Php::Exception("Context has been disposed");
+
+        // expose the context
+        return _context.Get(_isolate);
+    }
+
+    /**
+     *  Has the context been disposed?
+     *  @return bool
+     */
+    bool disposed() const { return _context.IsEmpty(); }
+
+    /**
+     *  Release the context and everything that is linked to it right away
+     */
+    void dispose();
+
+    /**
+     *  Register a PHP object that wraps a javascript value of this context
+     *  @param  object
+     */
+    void add(PhpBase *object) { _objects.insert(object); }
+
+    /**
+     *  Unregister a PHP object that wraps a javascript value of this context
+     *  @param  object
+     */
+    void remove(PhpBase *object) { _objects.erase(object); }
+
+    /**
+     *  Register an object that keeps a PHP variable alive on behalf of javascript
+     *  @param  holder
+     */
+    void add(Holder *holder);
+
+    /**
+     *  Unregister an object that keeps a PHP variable alive on behalf of javascript
+     *  @param  holder
+     */
+    void remove(Holder *holder);
 
     /**
      *  Assign a variable to the javascript context
      *  @param  name        name of property to assign  required
      *  @param  value       value to be assigned
      *  @param  attribytes  property attributes
+     *  @param  mode        conversion mode, or null to use the policy of the context
      *  @return bool
+     *  @throws Php::Exception
+     */
+    bool assign(const Php::Value &name, const Php::Value &value, const Php::Value &attributes, const Php::Value &mode);
+
+    /**
+     *  Assign a PHP callable to the javascript context as a real function
+     *  @param  name        name of the function
+     *  @param  callable    the PHP callable
+     *  @param  signature   array with parameter types, or null to use reflection
+     *  @return bool
+     *  @throws Php::Exception
+     */
+    bool assignFunction(const Php::Value &name, const Php::Value &callable, const Php::Value &signature);
+
+    /**
+     *  Assign a list of numbers to the javascript context as a typed array
+     *  @param  name        name of the property
+     *  @param  list        the PHP array with numbers
+     *  @param  type        the type of the typed array (JS\Float64 or JS\Int32), or null for JS\Float64
+     *  @return bool
+     *  @throws Php::Exception
+     */
+    bool assignNumeric(const Php::Value &name, const Php::Value &list, const Php::Value &type);
+
+    /**
+     *  Assign a JSON document to the javascript context, parsed by v8
+     *  @param  name        name of the property
+     *  @param  json        the JSON document
+     *  @return bool
+     *  @throws Php::Exception
      */
-    bool assign(const Php::Value &name, const Php::Value &value, const Php::Value &attributes);
+    bool assignJson(const Php::Value &name, const Php::Value &json);
 
     /**
      *  Parse a piece of javascript code
      *  @param  code        the code to execute
      *  @param  timeout     possible timeout in seconds
+     *  @param  flags       bitmask of flags for converting the result
      *  @return Php::Value
      *  @throws Php::Exception
      */
-    Php::Value evaluate(const Php::Value &code, const Php::Value &timeout);
+    Php::Value evaluate(const Php::Value &code, const Php::Value &timeout, const Php::Value &flags);
 };
 
 /**
@@ -12,9 +12,20 @@
 #include <phpcpp.h>
 #include "php_context.h"
 #include "php_object.h"
+#include "php_arrayobject.h"
+#include "php_buffer.h"
+#include "php_generator.h"
 #include "php_function.h"
 #include "php_script.h"
 #include "platform.h"
+#include "interned.h"
+#include "externalstring.h"
+#include "wrapper.h"
+#include "fromiterator.h"
+#include "link.h"
+#include "callable.h"
+#include "templatecache.h"
+#include "numeric.h"
 #include "names.h"
 
 /**
@@ -49,11 +60,66 @@ extern "C" {
         extension.add(Php::Constant(JS::Names::DontDelete,    v8::DontDelete));
         extension.add(Php::Constant(JS::Names::DontEnumerate, v8::DontEnum));
 
+        // the conversion modes
+        extension.add(Php::Constant(JS::Names::Proxy,         JS::Conversion::Proxy));
+        extension.add(Php::Constant(JS::Names::Copy,          JS::Conversion::Copy));
+        extension.add(Php::Constant(JS::Names::Auto,          JS::Conversion::Auto));
+
+        // the flags for converting the result of a script
+        extension.add(Php::Constant(JS::Names::AsRows,        JS::Script::AsRows));
+        extension.add(Php::Constant(JS::Names::AsJson,        JS::Script::AsJson));
+
+        // the types of typed arrays for lists of numbers
+        extension.add(Php::Constant(JS::Names::Float64,       JS::Numeric::Float64));
+        extension.add(Php::Constant(JS::Names::Int32,         JS::Numeric::Int32));
+
+        // javascript arrays can be converted into PHP arrays right away, or into lazy JS\Array objects
+        extension.add(Php::Ini("js.lazy_arrays", false));
+
+        // strings of at least this many bytes are shared with javascript instead of copied (zero to disable)
+        extension.add(Php::Ini("js.external_strings", int64_t(65536)));
+
+        // the maximum number of bytes for array buffers, read when the isolate is created (zero for no limit)
+        extension.add(Php::Ini("js.buffer_limit", int64_t(0)));
+
+        // the maximum number of classes for which the template is remembered (zero to disable)
+        extension.add(Php::Ini("js.template_cache", int64_t(256)));
+
+        // bytes per array element or object property that v8 is told that a PHP variable uses (zero to disable)
+        extension.add(Php::Ini("js.external_memory_factor", int64_t(64)));
+
+        // let the C++ heap of v8 manage the objects that wrap PHP variables (read when the isolate is created)
+        extension.add(Php::Ini("js.cppgc_wrappers", false));
+
         // create the classes
         Php::Class<JS::PhpContext> context(JS::Names::Context);
         Php::Class<JS::PhpScript> script(JS::Names::Script);
         Php::Class<JS::PhpObject> object(JS::Names::Object);
         Php::Class<JS::PhpFunction> function(JS::Names::Function);
+        Php::Class<JS::PhpArrayObject> array(JS::Names::Array);
+        Php::Class<JS::PhpBuffer> buffer(JS::Names::Buffer);
+        Php::Class<JS::PhpGenerator> iterator(JS::Names::Iterator);
+
+        // objects can be converted into arrays in one go
+        object.method<&JS::PhpObject::toArray>("toArray", {
+            Php::ByVal("depth", Php::Type::Numeric, false)
+        });
+
+        // a selection of the properties can be converted in one go as well
+        object.method<&JS::PhpObject::pluck>("pluck", {
+            Php::ByVal("names", Php::Type::Array, true),
+            Php::ByVal("depth", Php::Type::Numeric, false)
+        });
+
+        // lazy arrays can be converted into real PHP arrays
+        array.method<&JS::PhpArrayObject::toArray>("toArray", {
+            Php::ByVal("depth", Php::Type::Numeric, false)
+        });
+
+        // buffers are constructed with binary data
+        buffer.method<&JS::PhpBuffer::__construct>("__construct", {
+            Php::ByVal("data", Php::Type::String, false)
+        });
 
         // add a script-method to construct the script
         context.method<&JS::PhpContext::__construct>("__construct", {
@@ -64,7 +130,41 @@ extern "C" {
         context.method<&JS::PhpContext::assign>("assign", {
             Php::ByVal("name", Php::Type::String, true),
             Php::ByVal("value", Php::Type::Null, true),
-            Php::ByVal("attribute", Php::Type::Numeric, false)
+            Php::ByVal("attribute", Php::Type::Numeric, false),
+            Php::ByVal("conversion", Php::Type::Numeric, false)
+        });
+
+        // the policy for converting arrays and objects can be changed
+        context.method<&JS::PhpContext::setConversion>("setConversion", {
+            Php::ByVal("mode", Php::Type::Numeric, true),
+            Php::ByVal("maxsize", Php::Type::Numeric, false),
+            Php::ByVal("maxdepth", Php::Type::Numeric, false)
+        });
+
+        // statistics about the context
+        context.method<&JS::PhpContext::statistics>("statistics");
+
+        // the context can be released before the object is destructed
+        context.method<&JS::PhpContext::dispose>("dispose");
+
+        // callables can be assigned as real functions with a fixed signature
+        context.method<&JS::PhpContext::assignFunction>("assignFunction", {
+            Php::ByVal("name", Php::Type::String, true),
+            Php::ByVal("callable", Php::Type::Callable, true),
+            Php::ByVal("signature", Php::Type::Array, false)
+        });
+
+        // lists of numbers can be assigned as typed arrays
+        context.method<&JS::PhpContext::assignNumeric>("assignNumeric", {
+            Php::ByVal("name", Php::Type::String, true),
+            Php::ByVal("list", Php::Type::Array, true),
+            Php::ByVal("type", Php::Type::Numeric, false)
+        });
+
+        // JSON documents can be assigned without decoding them in PHP
+        context.method<&JS::PhpContext::assignJson>("assignJson", {
+            Php::ByVal("name", Php::Type::String, true),
+            Php::ByVal("json", Php::Type::String, true)
         });
 
         // add a method to just parse a script, the script is then linked to this
@@ -76,7 +176,8 @@ extern "C" {
         // add a method to parse + execute a script
         context.method<&JS::PhpContext::evaluate>("evaluate", {
             Php::ByVal("script", Php::Type::String, true),
-            Php::ByVal("timeout", Php::Type::Numeric, false)
+            Php::ByVal("timeout", Php::Type::Numeric, false),
+            Php::ByVal("flags", Php::Type::Numeric, false)
         });
 
         // add a script-method to construct the script
@@ -88,7 +189,8 @@ extern "C" {
         script.method<&JS::PhpScript::assign>("assign", {
             Php::ByVal("name", Php::Type::String, true),
             Php::ByVal("value", Php::Type::Null, true),
-            Php::ByVal("attribute", Php::Type::Numeric, false)
+            Php::ByVal("attribute", Php::Type::Numeric, false),
+            Php::ByVal("conversion", Php::Type::Numeric, false)
         });
 
         // add a script-method to reset
@@ -98,18 +200,43 @@ extern "C" {
 
         // add a script-method to execute
         script.method<&JS::PhpScript::execute>("execute", {
-            Php::ByVal("timeout", Php::Type::Numeric, false)
+            Php::ByVal("timeout", Php::Type::Numeric, false),
+            Php::ByVal("flags", Php::Type::Numeric, false)
         });
 
         // add the classes to the extension
         extension.add(std::move(context));
         extension.add(std::move(object));
         extension.add(std::move(function));
+        extension.add(std::move(array));
+        extension.add(std::move(buffer));
+        extension.add(std::move(iterator));
         extension.add(std::move(script));
 
+        // at the end of the request, the strings that are shared with javascript are moved out of the request memory
+        extension.onIdle([]{
+
+            // detach the strings
+            JS::ExternalString::detachAll();
+
+            // destruct the variables that were released by the garbage collector
+            JS::Wrapper::purge();
+
+            // and the iterators, links and functions that were garbage collected
+            JS::FromIterator::purge();
+            JS::Link::purge();
+            JS::Callable::purge();
+
+            // classes that were declared in this request may be redeclared in the next one
+            JS::TemplateCache::invalidate();
+        });
+
         // the platform needs to be cleaned up on engine shutdown
         extension.onShutdown([]{
 
+            // release the interned property names
+            JS::Interned::shutdown();
+
             // clean up the platform
             JS::Platform::shutdown();
         });
@@ -0,0 +1,136 @@
+/**
+ *  ExternalString.cpp
+ *
+ *  Implementation file for the ExternalString class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "externalstring.h"
+#include "core.h"
+#include "zendvalue.h"
+#include "latin1.h"
+#include <cstring>
+#include <cstdlib>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  All strings that are still in use by v8
+ *  @var std::unordered_set<ExternalString*>
+ */
+std::unordered_set<ExternalString *> ExternalString::_strings;
+
+/**
+ *  Strings below this size are always copied, because an external string has overhead of its own
+ *  @var size_t
+ */
+static constexpr size_t minimum = 1024;
+
+/**
+ *  Constructor
+ *  @param  string      the PHP string
+ */
+ExternalString::ExternalString(zend_string *string) :
+    _string(zend_string_copy(string)),
+    _data(ZSTR_VAL(string)),
+    _size(ZSTR_LEN(string))
+{
+    // register the string
+    _strings.insert(this);
+}
+
+/**
+ *  Destructor (called by v8 when the string is garbage collected)
+ */
+ExternalString::~ExternalString()
+{
+    // release the PHP string, or the memory of our own
+    if (_string != nullptr) zend_string_release(_string);
+    else free(const_cast<char *>(_data));
+
+    // unregister the string
+    _strings.erase(this);
+}
+
+/**
+ *  Move the data to memory of its own, and release the PHP string
+ */
+void ExternalString::detach()
+{
+    // already detached
+    if (_string == nullptr) return;
+
+    // copy the data
+    char *data = static_cast<char *>(malloc(_size));
+    memcpy(data, _data, _size);
+
+    // release the PHP string
+    zend_string_release(_string);
+
+    // use the copy from now on
+    _string = nullptr;
+    _data = data;
+
+    // v8 caches the pointer to the data, so it has to be updated
+    UpdateDataCache();
+}
+
+/**
+ *  Create an external javascript string for a PHP string
+ *  @param  isolate     the isolate
+ *  @param  value       the PHP string
+ *  @return v8::Local<v8::String>   empty if the string cannot be exposed as external string
+ */
+v8::Local<v8::String> ExternalString::create(v8::Isolate *isolate, const Php::Value &value)
+{
+    // the PHP string
+    zend_string *string = Z_STR_P(ZendValue::get(value));
+
+    // small strings are always copied
+    if (ZSTR_LEN(string) < minimum) return v8::Local<v8::String>();
+
+    // the threshold that was configured when the context was created (zero to disable external strings)
+    size_t threshold = Core::upgrade(isolate)->external();
+
+    // check if the string is big enough
+    if (threshold == 0 || ZSTR_LEN(string) < threshold) return v8::Local<v8::String>();
+
+    // a one-byte string must be latin-1, so we can only use this for ascii
+    if (Latin1::ascii(ZSTR_VAL(string), ZSTR_LEN(string)) != ZSTR_LEN(string)) return v8::Local<v8::String>();
+
+    // create the resource
+    auto *resource = new ExternalString(string);
+
+    // create the string (v8 takes ownership of the resource)
+    v8::Local<v8::String> result;
+    if (v8::String::NewExternalOneByte(isolate, resource).ToLocal(&result)) return result;
+
+    // v8 did not accept the resource (the string is too long)
+    delete resource;
+
+    // not possible
+    return v8::Local<v8::String>();
+}
+
+/**
+ *  Move all strings that are still in use to memory of their own (must be
+ *  called at the end of the request, before the request memory is released)
+ */
+void ExternalString::detachAll()
+{
+    // detach all strings
+    for (auto *string : _strings) string->detach();
+}
+
+/**
+ *  End of namespace
+ */
+}
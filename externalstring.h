@@ -0,0 +1,121 @@
+/**
+ *  ExternalString.h
+ *
+ *  Large PHP strings are not copied into the v8 heap, but exposed to
+ *  javascript as external strings that point to the zend_string. The
+ *  zend_string is kept alive until v8 no longer needs it.
+ *
+ *  Because v8 may hold on to a string after the PHP request has ended
+ *  (when all request memory is released), the strings that are still in
+ *  use at the end of the request are moved to memory of their own.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+#include <unordered_set>
+
+/**
+ *  Forward declarations
+ */
+struct _zend_string;
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class ExternalString : public v8::String::ExternalOneByteStringResource
+{
+private:
+    /**
+     *  All strings that are still in use by v8
+     *  @var std::unordered_set<ExternalString*>
+     */
+    static std::unordered_set<ExternalString *> _strings;
+
+    /**
+     *  The PHP string (nullptr after the string was detached from the request)
+     *  @var zend_string
+     */
+    struct _zend_string *_string;
+
+    /**
+     *  The characters
+     *  @var const char *
+     */
+    const char *_data;
+
+    /**
+     *  Number of characters
+     *  @var size_t
+     */
+    size_t _size;
+
+    /**
+     *  Constructor
+     *  @param  string      the PHP string
+     */
+    ExternalString(struct _zend_string *string);
+
+    /**
+     *  Move the data to memory of its own, and release the PHP string
+     */
+    void detach();
+
+public:
+    /**
+     *  No copying
+     *  @param  that
+     */
+    ExternalString(const ExternalString &that) = delete;
+
+    /**
+     *  Destructor (called by v8 when the string is garbage collected)
+     */
+    virtual ~ExternalString();
+
+    /**
+     *  The characters
+     *  @return const char *
+     */
+    virtual const char *data() const override { return _data; }
+
+    /**
+     *  Number of characters
+     *  @return size_t
+     */
+    virtual size_t length() const override { return _size; }
+
+    /**
+     *  Create an external javascript string for a PHP string
+     *  @param  isolate     the isolate
+     *  @param  value       the PHP string
+     *  @return v8::Local<v8::String>   empty if the string cannot be exposed as external string
+     */
+    static v8::Local<v8::String> create(v8::Isolate *isolate, const Php::Value &value);
+
+    /**
+     *  Move all strings that are still in use to memory of their own (must be
+     *  called at the end of the request, before the request memory is released)
+     */
+    static void detachAll();
+};
+
+/**
+ *  End of namespace
+ */
+}
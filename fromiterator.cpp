@@ -4,104 +4,321 @@
  *  Implementation file of the FromIterator class
  * 
  *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
- *  @copyright 2025 Copernica BV
+ *  @copyright 2025 - 2026 Copernica BV
  */
 
 /**
  *  Dependencies
  */
 #include "fromiterator.h"
-#include "scope.h"
+#include "fromphp.h"
+#include "exception.h"
+#include "zendvalue.h"
+#include "linker.h"
 
 /**
  *  Begin of namespace
  */
 namespace JS {
 
+/**
+ *  The data of iterators that were garbage collected
+ *  @var std::vector<Data*>
+ */
+std::vector<FromIterator::Data *> FromIterator::_released;
+
+/**
+ *  Template for the iterators
+ *  @var v8::Global<v8::FunctionTemplate>
+ */
+v8::Global<v8::FunctionTemplate> FromIterator::_class;
+
+/**
+ *  Template for the Symbol.iterator method of PHP arrays and objects
+ *  @var v8::Global<v8::FunctionTemplate>
+ */
+v8::Global<v8::FunctionTemplate> FromIterator::_method;
+
+/**
+ *  Template for the result objects
+ *  @var v8::Global<v8::ObjectTemplate>
+ */
+v8::Global<v8::ObjectTemplate> FromIterator::_result;
+
+/**
+ *  The "value" and "done" property names
+ *  @var v8::Global<v8::String>
+ */
+v8::Global<v8::String> FromIterator::_value;
+v8::Global<v8::String> FromIterator::_done;
+
+/**
+ *  Helper function to turn an exception that was thrown by a PHP iterator into a C++ exception
+ *  @throws Php::Exception
+ */
+static void check()
+{
+    // was an exception thrown?
+    if (EG(exception) == nullptr) return;
+
+    // take over the exception
+    zval exception;
+    ZVAL_OBJ_COPY(&exception, EG(exception));
+    Php::Value object(&exception);
+    zval_ptr_dtor(&exception);
+
+    // the exception is no longer pending in PHP
+    zend_clear_exception();
+
+    // pass it on as C++ exception
+    throw Php::Exception(object.call("getMessage").stringValue());
+}
+
+/**
+ *  Constructor
+ *  @param  isolate
+ *  @param  object      the javascript iterator
+ *  @param  value       the PHP array or traversable object
+ *  @throws Php::Exception
+ */
+FromIterator::Data::Data(v8::Isolate *isolate, const v8::Local<v8::Object> &object, const Php::Value &value) :
+    Holder(isolate), _isolate(isolate), _object(isolate, object), _value(value)
+{
+    // when the iterator is garbage collected before it is done, we clean up
+    _object.SetWeak<Data>(this, [](const v8::WeakCallbackInfo<Data> &info) {
+
+        // the handle must be reset right away, the data itself is deleted later
+        info.GetParameter()->_object.Reset();
+
+        // queue the data
+        _released.push_back(info.GetParameter());
+
+    }, v8::WeakCallbackType::kParameter);
+
+    // the underlying zval
+    zval *zv = ZendValue::get(_value);
+
+    // arrays are iterated by walking over the hashtable (we hold a reference, so the table does not change)
+    if (Z_TYPE_P(zv) == IS_ARRAY)
+    {
+        // start at the first element
+        _table = Z_ARRVAL_P(zv);
+        zend_hash_internal_pointer_reset_ex(_table, &_position);
+    }
+
+    // traversable objects have an iterator of their own (this also calls getIterator() for aggregates)
+    else if (Z_TYPE_P(zv) == IS_OBJECT && Z_OBJCE_P(zv)->get_iterator != nullptr)
+    {
+        // create the iterator
+        _zenditerator = Z_OBJCE_P(zv)->get_iterator(Z_OBJCE_P(zv), zv, 0);
+        check();
+
+        // nothing to iterate
+        if (_zenditerator == nullptr) return;
+
+        // start at the first element
+        if (_zenditerator->funcs->rewind != nullptr) _zenditerator->funcs->rewind(_zenditerator);
+
+        // the destructor is not called when the constructor throws, so we clean up ourselves
+        try { check(); } catch (...) { zend_iterator_dtor(_zenditerator); throw; }
+    }
+}
+
+/**
+ *  Destructor
+ */
+FromIterator::Data::~Data()
+{
+    // destruct the Zend iterator
+    if (_zenditerator != nullptr) zend_iterator_dtor(_zenditerator);
+}
+
+/**
+ *  Release the PHP array or object (when the context is disposed)
+ */
+void FromIterator::Data::release()
+{
+    // destruct the Zend iterator
+    if (_zenditerator != nullptr) zend_iterator_dtor(_zenditerator);
+
+    // the iterator is done
+    _zenditerator = nullptr;
+    _table = nullptr;
+
+    // forget the variable
+    _value = nullptr;
+}
+
+/**
+ *  Fetch the next value
+ *  @param  value       set to the next value
+ *  @return bool        false when the iterator is done
+ *  @throws Php::Exception
+ */
+bool FromIterator::Data::next(v8::Local<v8::Value> &value)
+{
+    // the element that was found
+    zval *element = nullptr;
+
+    // arrays
+    if (_table != nullptr)
+    {
+        // get the current element
+        element = zend_hash_get_current_data_ex(_table, &_position);
+
+        // if there is none, we are done
+        if (element == nullptr) return false;
+
+        // move on to the next element
+        zend_hash_move_forward_ex(_table, &_position);
+    }
+
+    // objects
+    else if (_zenditerator != nullptr)
+    {
+        // is the iterator still valid?
+        bool valid = _zenditerator->funcs->valid(_zenditerator) == SUCCESS;
+        check();
+
+        // if not, we are done
+        if (!valid) return false;
+
+        // get the current element
+        element = _zenditerator->funcs->get_current_data(_zenditerator);
+        check();
+
+        // no element means that we are done too
+        if (element == nullptr) return false;
+
+        // convert the value before we move on (generators reuse the zval)
+        ZVAL_DEREF(element);
+        value = FromPhp(_isolate, Php::Value(element));
+
+        // move on to the next element
+        _zenditerator->funcs->move_forward(_zenditerator);
+        check();
+
+        // done
+        return true;
+    }
+
+    // nothing to iterate
+    else return false;
+
+    // the array may hold references
+    ZVAL_DEREF(element);
+
+    // convert the value
+    value = FromPhp(_isolate, Php::Value(element));
+
+    // done
+    return true;
+}
+
 /**
  *  Constructor
  *  @param  isolate     the isolate
- *  @param  object      the object that will be returned
- *  @param  value       iterable php object
+ *  @param  value       PHP array or traversable object
+ *  @throws Php::Exception
  */
 FromIterator::FromIterator(v8::Isolate *isolate, const Php::Value &value)
 {
-    // we need a scope
-    Scope scope(isolate);
-    
+    // this is a good moment to get rid of the iterators that were garbage collected before
+    purge();
+
     // create a new object
-    _iterator = v8::Object::New(isolate);
-    
+    _iterator = tpl(isolate)->InstanceTemplate()->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
+
     // store pointer to state data
-    _iterator->SetPrivate(scope, symbol(isolate), v8::External::New(isolate, new Data(isolate, value)));
-    
-    // we need to set a "next" method and a "return" method on the iterator
-    auto nxtlabel = v8::String::NewFromUtf8Literal(isolate, "next");
-    auto retlabel = v8::String::NewFromUtf8Literal(isolate, "return");
-    
-    // we need the next and return methods
-    auto nxtmethod = v8::Function::New(scope, &FromIterator::nxtmethod).ToLocalChecked();
-    auto retmethod = v8::Function::New(scope, &FromIterator::retmethod).ToLocalChecked();
-    
-    // install them on the object
-    _iterator->Set(scope, nxtlabel, nxtmethod).Check();
-    _iterator->Set(scope, retlabel, retmethod).Check();
-    
-    // we also make the iterator of itself iterable (when the iterator is explicitly iterated) 
-    _iterator->Set(scope, v8::Symbol::GetIterator(isolate), _iterator).Check();    
+    _iterator->SetAlignedPointerInInternalField(0, new Data(isolate, _iterator, value));
 }
 
 /**
- *  Helper method gets the symbol to associate data with an iterator
+ *  Helper method to get the template for the iterators
  *  @param  isolate
- *  @return v8::Local<v8::Private>
+ *  @return v8::Local<v8::FunctionTemplate>
  */
-v8::Local<v8::Private> FromIterator::symbol(v8::Isolate *isolate)
+v8::Local<v8::FunctionTemplate> FromIterator::tpl(v8::Isolate *isolate)
 {
-    // lookup the symbol
-    return v8::Private::ForApi(isolate, v8::String::NewFromUtf8Literal(isolate, "php-js.iterator"));
+    // do we already have the template?
+    if (!_class.IsEmpty()) return _class.Get(isolate);
+
+    // create the template
+    auto result = v8::FunctionTemplate::New(isolate);
+
+    // the state is stored in an internal field
+    result->InstanceTemplate()->SetInternalFieldCount(1);
+
+    // the methods may only be called on iterators
+    auto signature = v8::Signature::New(isolate, result);
+
+    // install the methods on the prototype
+    auto prototype = result->PrototypeTemplate();
+    prototype->Set(isolate, "next", v8::FunctionTemplate::New(isolate, &FromIterator::nxtmethod, v8::Local<v8::Value>(), signature));
+    prototype->Set(isolate, "return", v8::FunctionTemplate::New(isolate, &FromIterator::retmethod, v8::Local<v8::Value>(), signature));
+
+    // the iterator of itself iterable (when the iterator is explicitly iterated)
+    prototype->Set(v8::Symbol::GetIterator(isolate), v8::FunctionTemplate::New(isolate, &FromIterator::itrmethod));
+
+    // the property names of the result objects
+    auto value = v8::String::NewFromUtf8Literal(isolate, "value", v8::NewStringType::kInternalized);
+    auto done = v8::String::NewFromUtf8Literal(isolate, "done", v8::NewStringType::kInternalized);
+
+    // the result objects all have the same properties
+    auto shape = v8::ObjectTemplate::New(isolate);
+    shape->Set(value, v8::Undefined(isolate));
+    shape->Set(done, v8::False(isolate));
+
+    // remember everything
+    _class.Reset(isolate, result);
+    _result.Reset(isolate, shape);
+    _value.Reset(isolate, value);
+    _done.Reset(isolate, done);
+
+    // done
+    return result;
 }
 
 /**
- *  Helper method to get access to underlying data
+ *  Helper method to create a result object
  *  @param  isolate
- *  @param  obj
- *  @return Data*
+ *  @param  value       the value
+ *  @param  done        is the iterator done?
+ *  @return v8::Local<v8::Object>
  */
-FromIterator::Data *FromIterator::restore(v8::Isolate *isolate, const v8::Local<v8::Object> &obj)
+v8::Local<v8::Object> FromIterator::result(v8::Isolate *isolate, const v8::Local<v8::Value> &value, bool done)
 {
-    // we need a local value
-    v8::Local<v8::Value> val;
+    // the current context
+    auto context = isolate->GetCurrentContext();
 
-    // get the symbol value
-    if (!obj->GetPrivate(isolate->GetCurrentContext(), symbol(isolate)).ToLocal(&val)) return nullptr;
-    
-    // should be external
-    if (!val->IsExternal()) return nullptr;
-    
-    // get the value back
-    return static_cast<Data *>(val.As<v8::External>()->Value());
+    // create the object (it already has the properties, so we only have to overwrite them)
+    auto result = _result.Get(isolate)->NewInstance(context).ToLocalChecked();
+
+    // set the properties
+    if (!value.IsEmpty()) result->Set(context, _value.Get(isolate), value).Check();
+    if (done) result->Set(context, _done.Get(isolate), v8::True(isolate)).Check();
+
+    // done
+    return result;
 }
 
 /**
  *  Helper method to destruct the underlying data
- *  @param  isolate
  *  @param  obj
- *  @return Data*
  */
-void FromIterator::destruct(v8::Isolate *isolate, const v8::Local<v8::Object> &obj)
+void FromIterator::destruct(const v8::Local<v8::Object> &obj)
 {
     // get the underlying data
-    auto *data = restore(isolate, obj);
-    
-    // do nothing if not needed
+    auto *data = static_cast<Data *>(obj->GetAlignedPointerFromInternalField(0));
+
+    // do nothing if already destructed
     if (data == nullptr) return;
 
+    // forget the data
+    obj->SetAlignedPointerInInternalField(0, nullptr);
+
     // destruct the object
     delete data;
-
-    // unset the symbol value
-    obj->DeletePrivate(isolate->GetCurrentContext(), symbol(isolate));
 }
 
 /**
@@ -111,32 +328,38 @@ void FromIterator::destruct(v8::Isolate *isolate, const v8::Local<v8::Object> &o
 void FromIterator::nxtmethod(const v8::FunctionCallbackInfo<v8::Value> &args)
 {
     // the current isolate
-    auto isolate = args.GetIsolate();
+    auto *isolate = args.GetIsolate();
     
     // get a handle scope
-    Scope scope(isolate);
+    v8::HandleScope scope(isolate);
     
     // the object that is being called
     auto obj = args.This();
 
     // pointer to data
-    auto *data = restore(isolate, obj);
-    
-    // if iterator was already destructed
-    if (data == nullptr || data->done()) return retmethod(args);
-    
-    // create a new return object
-    auto result = v8::Object::New(isolate);
-    
-    // set the value
-    result->Set(scope, v8::String::NewFromUtf8Literal(isolate, "value"), data->current()).Check();
-    result->Set(scope, v8::String::NewFromUtf8Literal(isolate, "done"), v8::Boolean::New(isolate, !data->next())).Check();
-    
+    auto *data = static_cast<Data *>(obj->GetAlignedPointerFromInternalField(0));
+
+    // avoid exceptions
+    try
+    {
+        // fetch the next value
+        v8::Local<v8::Value> value;
+        if (data != nullptr && data->next(value)) return args.GetReturnValue().Set(result(isolate, value, false));
+    }
+    catch (const Php::Exception &exception)
+    {
+        // the iterator can no longer be used
+        destruct(obj);
+
+        // pass the exception on to javascript userspace
+        return (void)isolate->ThrowException(Exception(isolate, exception));
+    }
+
+    // the iterator is done, so we can forget it
+    destruct(obj);
+
     // install the return-value
-    args.GetReturnValue().Set(result);
-    
-    // if the iterator is done by now we can forget it
-    if (data->done()) destruct(isolate, obj);
+    args.GetReturnValue().Set(result(isolate, v8::Local<v8::Value>(), true));
 }
 
 /**
@@ -146,29 +369,97 @@ void FromIterator::nxtmethod(const v8::FunctionCallbackInfo<v8::Value> &args)
 void FromIterator::retmethod(const v8::FunctionCallbackInfo<v8::Value> &args)
 {
     // the current isolate
-    auto isolate = args.GetIsolate();
+    auto *isolate = args.GetIsolate();
 
     // get a handle scope
-    Scope scope(isolate);
-    
-    // the object that is being called
-    auto obj = args.This();
+    v8::HandleScope scope(isolate);
 
     // destruct internally stored data
-    destruct(isolate, obj);
-
-    // create a new return object
-    auto result = v8::Object::New(isolate);
-    
-    // set the "done" state
-    result->Set(scope, v8::String::NewFromUtf8Literal(isolate, "done"), v8::True(isolate)).Check();
+    destruct(args.This());
 
     // install the return-value
-    args.GetReturnValue().Set(result);
+    args.GetReturnValue().Set(result(isolate, args[0], true));
+}
+
+/**
+ *  Method that is called to get the iterator of the iterator (which is the iterator itself)
+ *  @param  args
+ */
+void FromIterator::itrmethod(const v8::FunctionCallbackInfo<v8::Value> &args)
+{
+    // the iterator is its own iterator
+    args.GetReturnValue().Set(args.This());
+}
+
+/**
+ *  Method that is called to get the iterator of a PHP array or object
+ *  @param  args
+ */
+void FromIterator::phpmethod(const v8::FunctionCallbackInfo<v8::Value> &args)
+{
+    // the current isolate
+    auto *isolate = args.GetIsolate();
+
+    // get a handle scope
+    v8::HandleScope scope(isolate);
+
+    // avoid exceptions
+    try
+    {
+        // get original php array or object
+        Php::Value object = Linker(isolate, args.This()).value();
+
+        // create the iterator
+        args.GetReturnValue().Set(FromIterator(isolate, object).value());
+    }
+    catch (const Php::Exception &exception)
+    {
+        // pass the exception on to javascript userspace
+        isolate->ThrowException(Exception(isolate, exception));
+    }
+}
+
+/**
+ *  The Symbol.iterator method for PHP arrays and traversable objects
+ *  @param  isolate
+ *  @return v8::Local<v8::Function>
+ */
+v8::Local<v8::Function> FromIterator::method(v8::Isolate *isolate)
+{
+    // create the template the first time
+    if (_method.IsEmpty()) _method.Reset(isolate, v8::FunctionTemplate::New(isolate, &FromIterator::phpmethod));
+
+    // v8 caches the function that is created for a template
+    return _method.Get(isolate)->GetFunction(isolate->GetCurrentContext()).ToLocalChecked();
+}
+
+/**
+ *  Delete the data of the iterators that were garbage collected
+ */
+void FromIterator::purge()
+{
+    // take over the data (destructing a Zend iterator could create new iterators)
+    std::vector<Data *> released;
+    released.swap(_released);
+
+    // delete the data
+    for (auto *data : released) delete data;
+}
+
+/**
+ *  Forget the templates (must be called before the isolate is disposed)
+ */
+void FromIterator::reset()
+{
+    // forget all handles
+    _method.Reset();
+    _class.Reset();
+    _result.Reset();
+    _value.Reset();
+    _done.Reset();
 }
     
 /**
  *  End of namespace
  */
 }
-
@@ -1,11 +1,17 @@
 /**
  *  FromIterator.h
  * 
- *  Class that turns a PHP traversable object into something that
+ *  Class that turns a PHP array or traversable object into something that
  *  is iterable in a javascript environment too.
+ *
+ *  Arrays are iterated by walking over the hashtable, and objects (user
+ *  space iterators, internal iterators and generators) via the iterator
+ *  API of the Zend engine, so that no PHP methods have to be looked up by
+ *  name. The iterator objects and the result objects are created from
+ *  templates, so that they all have the same shape.
  * 
  *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
- *  @copyright 2025 Copernica BV
+ *  @copyright 2025 - 2026 Copernica BV
  */
 
 /**
@@ -16,7 +22,16 @@
 /**
  *  Dependencies
  */
-#include "fromphp.h"
+#include <phpcpp.h>
+#include <v8.h>
+#include <vector>
+#include "holder.h"
+
+/**
+ *  Forward declarations
+ */
+struct _zend_object_iterator;
+struct _zend_array;
 
 /**
  *  Begin of namespace
@@ -36,10 +51,10 @@ private:
     v8::Local<v8::Object> _iterator;
     
     /**
-     *  Structure that holds the data associated with the iterator,
-     *  and that is added via a symbol in the javascript-object
+     *  Structure that holds the state of the iterator, it is stored in the
+     *  internal field of the javascript object
      */
-    class Data
+    class Data : public Holder
     {
     private:
         /**
@@ -49,78 +64,123 @@ private:
         v8::Isolate *_isolate;
 
         /**
-         *  The PHP space Iterator object
+         *  Weak reference to the javascript iterator, to clean up when it is garbage collected
+         *  @var v8::Global<v8::Object>
+         */
+        v8::Global<v8::Object> _object;
+
+        /**
+         *  The PHP array or object that is iterated
          *  @var Php::Value
          */
         Php::Value _value;
-    
-    public:
+
         /**
-         *  Constructor
-         *  @param  isolate
-         *  @param  iterator
+         *  The hashtable (when an array is iterated)
+         *  @var HashTable
+         */
+        struct _zend_array *_table = nullptr;
+
+        /**
+         *  The position in the hashtable
+         *  @var uint32_t
          */
-        Data(v8::Isolate *isolate, const Php::Value &value) :
-            _isolate(isolate), _value(value) {}
-            
+        uint32_t _position = 0;
+
         /**
-         *  Destructor
+         *  The Zend iterator (when an object is iterated)
+         *  @var zend_object_iterator
          */
-        virtual ~Data() = default;
-        
+        struct _zend_object_iterator *_zenditerator = nullptr;
+
+    public:
         /**
-         *  Is the iterator still valid?
-         *  @return bool
+         *  Constructor
+         *  @param  isolate
+         *  @param  object      the javascript iterator
+         *  @param  value       the PHP array or traversable object
+         *  @throws Php::Exception
          */
-        bool valid() { return _value.call("valid"); }
-        
+        Data(v8::Isolate *isolate, const v8::Local<v8::Object> &object, const Php::Value &value);
+
         /**
-         *  Is the iterator done?
-         *  @return bool
+         *  No copying
+         *  @param  that
          */
-        bool done() { return !valid(); }
-        
+        Data(const Data &that) = delete;
+
         /**
-         *  Get the current value
-         *  @return Php::Value
+         *  Destructor
          */
-        Php::Value value() { return _value.call("current"); }
-        
+        virtual ~Data();
+
         /**
-         *  Get the current value
-         *  @return v8::Local
+         *  Release the PHP array or object (when the context is disposed)
          */
-        v8::Local<v8::Value> current() { return FromPhp(_isolate, _value.call("current")); }
-        
+        virtual void release() override;
+
         /**
-         *  Proceed to the next record
-         *  @return bool
+         *  Fetch the next value
+         *  @param  value       set to the next value
+         *  @return bool        false when the iterator is done
+         *  @throws Php::Exception
          */
-        bool next() { _value.call("next"); return valid(); }
+        bool next(v8::Local<v8::Value> &value);
     };
 
     /**
-     *  Helper method gets the symbol to associate data with an iterator
-     *  @param  isolate
-     *  @return v8::Local<v8::Private>
+     *  The data of iterators that were garbage collected, they are deleted
+     *  later because v8 does not allow this during a garbage collection
+     *  @var std::vector<Data*>
+     */
+    static std::vector<Data *> _released;
+
+    /**
+     *  Template for the iterators
+     *  @var v8::Global<v8::FunctionTemplate>
+     */
+    static v8::Global<v8::FunctionTemplate> _class;
+
+    /**
+     *  Template for the Symbol.iterator method of PHP arrays and objects
+     *  @var v8::Global<v8::FunctionTemplate>
      */
-    static v8::Local<v8::Private> symbol(v8::Isolate *isolate);
+    static v8::Global<v8::FunctionTemplate> _method;
 
     /**
-     *  Helper method to get access to the underlying data
+     *  Template for the result objects
+     *  @var v8::Global<v8::ObjectTemplate>
+     */
+    static v8::Global<v8::ObjectTemplate> _result;
+
+    /**
+     *  The "value" and "done" property names
+     *  @var v8::Global<v8::String>
+     */
+    static v8::Global<v8::String> _value;
+    static v8::Global<v8::String> _done;
+
+    /**
+     *  Helper method to get the template for the iterators
      *  @param  isolate
-     *  @param  obj
-     *  @return Data*
+     *  @return v8::Local<v8::FunctionTemplate>
      */
-    static Data *restore(v8::Isolate *isolate, const v8::Local<v8::Object> &obj);
-    
+    static v8::Local<v8::FunctionTemplate> tpl(v8::Isolate *isolate);
+
     /**
-     *  Destruct internally stored data
+     *  Helper method to create a result object
      *  @param  isolate
+     *  @param  value       the value
+     *  @param  done        is the iterator done?
+     *  @return v8::Local<v8::Object>
+     */
+    static v8::Local<v8::Object> result(v8::Isolate *isolate, const v8::Local<v8::Value> &value, bool done);
+
+    /**
+     *  Destruct the internally stored data
      *  @param  obj
-     *  @return Data*
      */
-    static void destruct(v8::Isolate *isolate, const v8::Local<v8::Object> &obj);
+    static void destruct(const v8::Local<v8::Object> &obj);
 
     /**
      *  Method that is called by v8 when the next item is requested
@@ -134,17 +194,29 @@ private:
      */
     static void retmethod(const v8::FunctionCallbackInfo<v8::Value> &args);
 
+    /**
+     *  Method that is called to get the iterator of the iterator (which is the iterator itself)
+     *  @param  args
+     */
+    static void itrmethod(const v8::FunctionCallbackInfo<v8::Value> &args);
+
+    /**
+     *  Method that is called to get the iterator of a PHP array or object
+     *  @param  args
+     */
+    static void phpmethod(const v8::FunctionCallbackInfo<v8::Value> &args);
 
 public:
     /**
      *  Constructor
      *  @param  isolate     the isolate
-     *  @param  value       iterable php object
+     *  @param  value       PHP array or traversable object
+     *  @throws Php::Exception
      */
     FromIterator(v8::Isolate *isolate, const Php::Value &value);
 
     /**
-     *  Private destructor (object is self-destructing)
+     *  Destructor
      */
     virtual ~FromIterator() = default;
 
@@ -153,10 +225,27 @@ public:
      *  @return v8::Local<v8::Object>
      */
     v8::Local<v8::Object> &value() { return _iterator; }
+
+    /**
+     *  The Symbol.iterator method for PHP arrays and traversable objects
+     *  @param  isolate
+     *  @return v8::Local<v8::Function>
+     */
+    static v8::Local<v8::Function> method(v8::Isolate *isolate);
+
+    /**
+     *  Delete the data of the iterators that were garbage collected (destructing
+     *  a Zend iterator can run PHP code, so this is done outside the garbage collector)
+     */
+    static void purge();
+
+    /**
+     *  Forget the templates (must be called before the isolate is disposed)
+     */
+    static void reset();
 };
     
 /**
  *  End of namespace
  */
 }
-
@@ -12,12 +12,53 @@
  */
 #include "fromphp.h"
 #include "core.h"
+#include "externalstring.h"
+#include "latin1.h"
+#include "zendvalue.h"
+#include <memory>
+#include <cstring>
 
 /**
  *  Begin of namespace
  */
 namespace JS {
 
+/**
+ *  Helper function to convert a PHP string
+ *  @param  isolate
+ *  @param  value
+ *  @return v8::Local<v8::String>
+ */
+static v8::Local<v8::String> string(v8::Isolate *isolate, const Php::Value &value)
+{
+    // large strings are not copied, but shared with PHP
+    auto result = ExternalString::create(isolate, value);
+    if (!result.IsEmpty()) return result;
+
+    // the PHP string
+    zend_string *string = Z_STR_P(ZendValue::get(value));
+    const char *data = ZSTR_VAL(string);
+    size_t size = ZSTR_LEN(string);
+
+    // most strings are plain ascii, which is the same in latin-1, so they do not have to be decoded
+    size_t prefix = Latin1::ascii(data, size);
+    if (prefix == size) return v8::String::NewFromOneByte(isolate, reinterpret_cast<const uint8_t *>(data), v8::NewStringType::kNormal, size).ToLocalChecked();
+
+    // small strings are decoded on the stack, large strings on the heap
+    uint8_t local[1024]; std::unique_ptr<uint8_t[]> allocated;
+    uint8_t *buffer = size <= sizeof(local) ? local : (allocated = std::make_unique_for_overwrite<uint8_t[]>(size)).get();
+
+    // the ascii prefix can be copied, the rest is decoded (if all characters are in latin-1)
+    memcpy(buffer, data, prefix);
+    size_t decoded = Latin1::decode(data + prefix, size - prefix, buffer + prefix);
+
+    // if the string fits in latin-1, we create a one-byte string
+    if (decoded != SIZE_MAX) return v8::String::NewFromOneByte(isolate, buffer, v8::NewStringType::kNormal, prefix + decoded).ToLocalChecked();
+
+    // otherwise v8 has to decode the utf-8
+    return v8::String::NewFromUtf8(isolate, data, v8::NewStringType::kNormal, size).ToLocalChecked();
+}
+
 /**
  *  Constructor
  *  @param  isolate
@@ -33,9 +74,9 @@ FromPhp::FromPhp(v8::Isolate *isolate, const Php::Value &value)
     case Php::Type::Bool:       operator=(v8::Boolean::New(isolate, value)); return;
     case Php::Type::True:       operator=(v8::Boolean::New(isolate, true)); return;
     case Php::Type::False:      operator=(v8::Boolean::New(isolate, false)); return;
-    case Php::Type::String:     operator=(v8::String::NewFromUtf8(isolate, value).ToLocalChecked()); return;
-    case Php::Type::Object:     operator=(Core::upgrade(isolate)->wrap(value)); return;
-    case Php::Type::Array:      operator=(Core::upgrade(isolate)->wrap(value)); return;
+    case Php::Type::String:     operator=(string(isolate, value)); return;
+    case Php::Type::Object:     operator=(Core::upgrade(isolate)->convert(value)); return;
+    case Php::Type::Array:      operator=(Core::upgrade(isolate)->convert(value)); return;
     default:                    operator=(v8::Undefined(isolate)); return;
     }
     
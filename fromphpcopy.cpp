@@ -0,0 +1,180 @@
+/**
+ *  FromPhpCopy.cpp
+ *
+ *  Implementation file for the FromPhpCopy class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "fromphpcopy.h"
+#include "fromphp.h"
+#include "core.h"
+#include "php_base.h"
+#include "zendvalue.h"
+#include <limits>
+#include <vector>
+#include <string>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Constructor
+ *  @param  core        the core that is used for wrapping nested objects
+ *  @param  conversion  the policy
+ */
+FromPhpCopy::FromPhpCopy(Core *core, const Conversion &conversion) :
+    _core(core),
+    _isolate(core->isolate()),
+    _context(_isolate->GetCurrentContext()),
+    _conversion(conversion),
+    _budget(conversion.mode() == Conversion::Auto ? conversion.maxsize() : std::numeric_limits<size_t>::max()) {}
+
+/**
+ *  Can a value be copied at all?
+ *  @param  value
+ *  @return bool
+ */
+bool FromPhpCopy::copyable(const Php::Value &value)
+{
+    // arrays can always be copied
+    if (value.isArray()) return true;
+
+    // objects only if they know how to serialize themselves (but objects that came from javascript never)
+    return value.isObject() && value.instanceOf("JsonSerializable") && PhpBase::unwrap(value) == nullptr;
+}
+
+/**
+ *  Called when a value exceeds the thresholds
+ *  @param  value       the value that is too big
+ *  @return v8::MaybeLocal<v8::Value>   empty in automatic mode
+ */
+v8::MaybeLocal<v8::Value> FromPhpCopy::exceeded(const Php::Value &value)
+{
+    // in automatic mode we give up, so that the caller falls back to a proxy
+    if (_conversion.mode() == Conversion::Auto) return v8::MaybeLocal<v8::Value>();
+
+    // otherwise only this part of the value is proxied
+    return _core->wrap(value);
+}
+
+/**
+ *  Copy a value
+ *  @param  value       the value to copy
+ *  @param  depth       the current depth
+ *  @return v8::MaybeLocal<v8::Value>   empty if the value is too big
+ */
+v8::MaybeLocal<v8::Value> FromPhpCopy::copy(const Php::Value &value, size_t depth)
+{
+    // the underlying zval
+    zval *zv = ZendValue::get(value);
+
+    // check the type
+    switch (Z_TYPE_P(zv)) {
+    case IS_ARRAY:
+        // check the thresholds
+        if (depth >= _conversion.maxdepth() || zend_hash_num_elements(Z_ARRVAL_P(zv)) > _budget) return exceeded(value);
+
+        // the elements are now accounted for
+        _budget -= zend_hash_num_elements(Z_ARRVAL_P(zv));
+
+        // copy the hashtable
+        return copy(Z_ARRVAL_P(zv), depth + 1);
+
+    case IS_OBJECT:
+        // regular objects keep their identity, so they are always wrapped
+        if (!copyable(value)) return _core->wrap(value);
+
+        // check the thresholds
+        if (depth >= _conversion.maxdepth()) return exceeded(value);
+
+        // copy the serialized representation
+        return copy(value.call("jsonSerialize"), depth + 1);
+
+    default:
+        // scalars are converted the normal way
+        return FromPhp(_isolate, value);
+    }
+}
+
+/**
+ *  Copy a hashtable
+ *  @param  table       the hashtable to copy
+ *  @param  depth       the current depth
+ *  @return v8::MaybeLocal<v8::Value>   empty if the table is too big
+ */
+v8::MaybeLocal<v8::Value> FromPhpCopy::copy(HashTable *table, size_t depth)
+{
+    // variables for the loops
+    zend_ulong index; zend_string *key; zval *element;
+
+    // lists become real arrays
+    if (zend_array_is_list(table))
+    {
+        // all values are collected first, so that the array can be constructed in one go
+        std::vector<v8::Local<v8::Value>> values;
+        values.reserve(zend_hash_num_elements(table));
+
+        // walk over the elements
+        ZEND_HASH_FOREACH_VAL(table, element)
+        {
+            // the array may hold references
+            ZVAL_DEREF(element);
+
+            // copy the element
+            v8::Local<v8::Value> value;
+            if (!copy(Php::Value(element), depth).ToLocal(&value)) return v8::MaybeLocal<v8::Value>();
+
+            // add to the values
+            values.push_back(value);
+        }
+        ZEND_HASH_FOREACH_END();
+
+        // construct the array
+        return v8::Array::New(_isolate, values.data(), values.size());
+    }
+
+    // other arrays become plain objects
+    auto result = v8::Object::New(_isolate);
+
+    // walk over the elements
+    ZEND_HASH_FOREACH_KEY_VAL(table, index, key, element)
+    {
+        // the array may hold references
+        ZVAL_DEREF(element);
+
+        // copy the element
+        v8::Local<v8::Value> value;
+        if (!copy(Php::Value(element), depth).ToLocal(&value)) return v8::MaybeLocal<v8::Value>();
+
+        // the outcome of storing the property
+        v8::Maybe<bool> stored = v8::Nothing<bool>();
+
+        // string keys are internalized, because objects with the same keys are likely to share a shape
+        if (key != nullptr) stored = result->CreateDataProperty(_context, v8::String::NewFromUtf8(_isolate, ZSTR_VAL(key), v8::NewStringType::kInternalized, ZSTR_LEN(key)).ToLocalChecked(), value);
+
+        // non-negative numeric keys are stored as indices
+        else if (index < std::numeric_limits<uint32_t>::max()) stored = result->CreateDataProperty(_context, uint32_t(index), value);
+
+        // other numeric keys (like negative numbers) become strings
+        else stored = result->CreateDataProperty(_context, v8::String::NewFromUtf8(_isolate, std::to_string(zend_long(index)).data()).ToLocalChecked(), value);
+
+        // stop if this failed
+        if (stored.IsNothing()) return v8::MaybeLocal<v8::Value>();
+    }
+    ZEND_HASH_FOREACH_END();
+
+    // expose the object
+    return result;
+}
+
+/**
+ *  End of namespace
+ */
+}
@@ -0,0 +1,136 @@
+/**
+ *  FromPhpCopy.h
+ *
+ *  Class to deep copy a PHP array (or a JsonSerializable object) into
+ *  native javascript arrays and objects. Lists become real arrays, other
+ *  arrays become plain objects. Regular PHP objects that are found inside
+ *  the value keep their identity, and are still wrapped in a proxy.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+#include "conversion.h"
+
+/**
+ *  Forward declarations
+ */
+struct _zend_array;
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Forward declarations
+ */
+class Core;
+
+/**
+ *  Class definition
+ */
+class FromPhpCopy
+{
+private:
+    /**
+     *  The core that is used for wrapping nested objects
+     *  @var Core
+     */
+    Core *_core;
+
+    /**
+     *  The isolate
+     *  @var v8::Isolate
+     */
+    v8::Isolate *_isolate;
+
+    /**
+     *  The current context
+     *  @var v8::Local<v8::Context>
+     */
+    v8::Local<v8::Context> _context;
+
+    /**
+     *  The policy
+     *  @var Conversion
+     */
+    const Conversion &_conversion;
+
+    /**
+     *  Number of elements that may still be copied
+     *  @var size_t
+     */
+    size_t _budget;
+
+    /**
+     *  Copy a value
+     *  @param  value       the value to copy
+     *  @param  depth       the current depth
+     *  @return v8::MaybeLocal<v8::Value>   empty if the value is too big
+     */
+    v8::MaybeLocal<v8::Value> copy(const Php::Value &value, size_t depth);
+
+    /**
+     *  Copy a hashtable
+     *  @param  table       the hashtable to copy
+     *  @param  depth       the current depth
+     *  @return v8::MaybeLocal<v8::Value>   empty if the table is too big
+     */
+    v8::MaybeLocal<v8::Value> copy(struct _zend_array *table, size_t depth);
+
+    /**
+     *  Called when a value exceeds the thresholds
+     *  @param  value       the value that is too big
+     *  @return v8::MaybeLocal<v8::Value>   empty in automatic mode
+     */
+    v8::MaybeLocal<v8::Value> exceeded(const Php::Value &value);
+
+public:
+    /**
+     *  Constructor
+     *  @param  core        the core that is used for wrapping nested objects
+     *  @param  conversion  the policy
+     */
+    FromPhpCopy(Core *core, const Conversion &conversion);
+
+    /**
+     *  No copying
+     *  @param  that
+     */
+    FromPhpCopy(const FromPhpCopy &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~FromPhpCopy() = default;
+
+    /**
+     *  Can a value be copied at all?
+     *  @param  value
+     *  @return bool
+     */
+    static bool copyable(const Php::Value &value);
+
+    /**
+     *  Copy a value
+     *  @param  value       the value to copy
+     *  @return v8::MaybeLocal<v8::Value>   empty if the value is too big to copy (automatic mode only)
+     */
+    v8::MaybeLocal<v8::Value> value(const Php::Value &value) { return copy(value, 0); }
+};
+
+/**
+ *  End of namespace
+ */
+}
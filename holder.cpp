@@ -0,0 +1,50 @@
+/**
+ *  Holder.cpp
+ *
+ *  Implementation file for the Holder class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "holder.h"
+#include "core.h"
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Constructor, the holder is registered with the current context
+ *  @param  isolate
+ */
+Holder::Holder(v8::Isolate *isolate)
+{
+    // the context in which the holder is created
+    auto context = isolate->GetCurrentContext();
+    if (context.IsEmpty()) return;
+
+    // the context points to the core
+    _core = static_cast<Core *>(context->GetAlignedPointerFromEmbedderData(0));
+
+    // register ourselves
+    _core->add(this);
+}
+
+/**
+ *  Destructor
+ */
+Holder::~Holder()
+{
+    // unregister ourselves (unless the context was already disposed)
+    if (_core != nullptr) _core->remove(this);
+}
+
+/**
+ *  End of namespace
+ */
+}
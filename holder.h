@@ -0,0 +1,98 @@
+/**
+ *  Holder.h
+ *
+ *  Base class for the objects that keep a PHP variable alive on behalf of
+ *  javascript: the links and wrappers of PHP objects and arrays, the
+ *  functions that were assigned with assignFunction() and the iterators
+ *  over PHP arrays and objects.
+ *
+ *  All isolates share the same heap, so these objects can stay around until
+ *  the garbage collector runs, long after the context that created them was
+ *  disposed. Every holder is therefore registered with the context in which
+ *  it was created, so that the PHP variable can be released right away when
+ *  the context is disposed.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <v8.h>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Forward declarations
+ */
+class Core;
+
+/**
+ *  Class definition
+ */
+class Holder
+{
+private:
+    /**
+     *  The context with which the holder is registered (nullptr after the context was disposed)
+     *  @var Core
+     */
+    Core *_core = nullptr;
+
+    /**
+     *  The previous and next holder of the same context
+     *  @var Holder
+     */
+    Holder *_prev = nullptr;
+    Holder *_next = nullptr;
+
+    /**
+     *  The context maintains the list of holders
+     */
+    friend class Core;
+
+protected:
+    /**
+     *  Constructor, the holder is registered with the current context
+     *  @param  isolate
+     */
+    Holder(v8::Isolate *isolate);
+
+    /**
+     *  No copying
+     *  @param  that
+     */
+    Holder(const Holder &that) = delete;
+
+    /**
+     *  The context with which the holder is registered
+     *  @return Core
+     */
+    Core *core() const { return _core; }
+
+public:
+    /**
+     *  Destructor
+     */
+    virtual ~Holder();
+
+    /**
+     *  Release the PHP variable (called when the context is disposed, the holder itself
+     *  stays around until javascript no longer refers to it)
+     */
+    virtual void release() = 0;
+};
+
+/**
+ *  End of namespace
+ */
+}
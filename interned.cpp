@@ -0,0 +1,246 @@
+/**
+ *  Interned.cpp
+ *
+ *  Implementation file for the Interned class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "interned.h"
+#include "zendvalue.h"
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  All entries, the most recently used entry comes first
+ *  @var std::list<Entry>
+ */
+std::list<Interned::Entry> Interned::_entries;
+
+/**
+ *  Index of the entries by the hash of the javascript string
+ *  @var std::unordered_multimap
+ */
+std::unordered_multimap<int, std::list<Interned::Entry>::iterator> Interned::_jsindex;
+
+/**
+ *  Index of the entries by the hash of the PHP string
+ *  @var std::unordered_multimap
+ */
+std::unordered_multimap<uint64_t, std::list<Interned::Entry>::iterator> Interned::_phpindex;
+
+/**
+ *  Helper function to turn a zend_string into a Php::Value
+ *  @param  name
+ *  @return Php::Value
+ */
+static Php::Value wrap(zend_string *name)
+{
+    // the Php::Value constructor adds a reference to the string, so this does not allocate anything
+    zval value;
+    ZVAL_STR(&value, name);
+
+    // wrap it
+    return Php::Value(&value);
+}
+
+/**
+ *  Helper function to remove an entry from one of the indices
+ *  @param  index       the index
+ *  @param  hash        the hash under which the entry is stored
+ *  @param  entry       the entry to remove
+ */
+template <typename INDEX, typename HASH, typename ENTRY>
+static void unindex(INDEX &index, HASH hash, ENTRY entry)
+{
+    // look up the entries with the same hash
+    auto range = index.equal_range(hash);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        // is this the entry?
+        if (iter->second != entry) continue;
+
+        // remove it
+        index.erase(iter);
+
+        // done
+        return;
+    }
+}
+
+/**
+ *  Mark an entry as the most recently used one
+ *  @param  entry       the entry
+ */
+void Interned::touch(std::list<Entry>::iterator entry)
+{
+    // move the entry to the front (this does not invalidate the iterators in the indices)
+    _entries.splice(_entries.begin(), _entries, entry);
+}
+
+/**
+ *  Remove the entry that was used the longest time ago
+ */
+void Interned::evict()
+{
+    // the last entry
+    auto entry = std::prev(_entries.end());
+
+    // remove it from the indices
+    unindex(_jsindex, entry->hash, entry);
+    unindex(_phpindex, ZSTR_H(entry->name), entry);
+
+    // release our reference to the PHP string (PHP values may still use it)
+    zend_string_release(entry->name);
+
+    // forget the entry
+    _entries.erase(entry);
+}
+
+/**
+ *  Add an entry to the table
+ *  @param  isolate     the isolate
+ *  @param  string      the internalized javascript string
+ *  @param  data        the characters
+ *  @param  size        number of bytes
+ *  @return zend_string the persistent PHP string
+ */
+zend_string *Interned::add(v8::Isolate *isolate, const v8::Local<v8::String> &string, const char *data, size_t size)
+{
+    // make room for the entry
+    if (_entries.size() >= capacity) evict();
+
+    // create a persistent string, and calculate the hash right away
+    zend_string *name = zend_string_init(data, size, true);
+    zend_string_hash_val(name);
+
+    // the string is refcounted from within requests, which is fine because we never share it between threads
+    GC_MAKE_PERSISTENT_LOCAL(name);
+
+    // construct the entry at the front
+    auto &entry = _entries.emplace_front();
+    entry.string.Reset(isolate, string);
+    entry.hash = string->GetIdentityHash();
+    entry.name = name;
+
+    // add to the indices
+    _jsindex.emplace(entry.hash, _entries.begin());
+    _phpindex.emplace(ZSTR_H(name), _entries.begin());
+
+    // expose the PHP string
+    return name;
+}
+
+/**
+ *  Convert a javascript property name to a PHP string
+ *  @param  isolate     the isolate
+ *  @param  name        the javascript name (must be a string)
+ *  @return Php::Value
+ */
+Php::Value Interned::php(v8::Isolate *isolate, const v8::Local<v8::Name> &name)
+{
+    // the name as string
+    v8::Local<v8::String> string = name.As<v8::String>();
+
+    // look up the entries with the same hash
+    auto range = _jsindex.equal_range(name->GetIdentityHash());
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        // property names are internalized, so this is normally a pointer comparison
+        if (!iter->second->string.Get(isolate)->StringEquals(string)) continue;
+
+        // this entry was used most recently
+        touch(iter->second);
+
+        // expose the PHP string
+        return wrap(iter->second->name);
+    }
+
+    // convert to utf8
+    v8::String::Utf8Value utf8(isolate, string);
+
+    // long names are converted the regular way
+    if (size_t(utf8.length()) > maxlength) return Php::Value(*utf8, utf8.length());
+
+    // we store an internalized version of the javascript string
+    auto internalized = v8::String::NewFromUtf8(isolate, *utf8, v8::NewStringType::kInternalized, utf8.length()).ToLocalChecked();
+
+    // add to the table, and expose the PHP string
+    return wrap(add(isolate, internalized, *utf8, utf8.length()));
+}
+
+/**
+ *  Convert a PHP property name to a javascript string
+ *  @param  isolate     the isolate
+ *  @param  name        the PHP name
+ *  @return v8::Local<v8::String>
+ */
+v8::Local<v8::String> Interned::js(v8::Isolate *isolate, const Php::Value &name)
+{
+    // the underlying zval
+    zval *value = ZendValue::get(name);
+
+    // the name must be a string
+    if (Z_TYPE_P(value) != IS_STRING) return js(isolate, name.clone(Php::Type::String));
+
+    // the PHP string
+    zend_string *input = Z_STR_P(value);
+
+    // look up the entries with the same hash (the hash is cached inside the zend_string)
+    auto range = _phpindex.equal_range(zend_string_hash_val(input));
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        // check if this is the same string
+        if (!zend_string_equals(iter->second->name, input)) continue;
+
+        // this entry was used most recently
+        touch(iter->second);
+
+        // expose the javascript string
+        return iter->second->string.Get(isolate);
+    }
+
+    // create an internalized javascript string
+    auto result = v8::String::NewFromUtf8(isolate, ZSTR_VAL(input), v8::NewStringType::kInternalized, ZSTR_LEN(input)).ToLocalChecked();
+
+    // add to the table (unless the name is too long)
+    if (ZSTR_LEN(input) <= maxlength) add(isolate, result, ZSTR_VAL(input), ZSTR_LEN(input));
+
+    // expose the javascript string
+    return result;
+}
+
+/**
+ *  Forget all entries (must be called before the isolate is disposed)
+ */
+void Interned::reset()
+{
+    // release our references to the PHP strings (PHP values may still use them)
+    for (auto &entry : _entries) zend_string_release(entry.name);
+
+    // forget the indices and the entries
+    _jsindex.clear();
+    _phpindex.clear();
+    _entries.clear();
+}
+
+/**
+ *  Release all resources (called when the extension is unloaded)
+ */
+void Interned::shutdown()
+{
+    // forget the entries
+    reset();
+}
+
+/**
+ *  End of namespace
+ */
+}
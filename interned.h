@@ -0,0 +1,151 @@
+/**
+ *  Interned.h
+ *
+ *  Table with property names that are often passed between PHP and
+ *  javascript. Every entry links an internalized javascript string to a
+ *  persistent zend_string (with a precomputed hash), so that the hot
+ *  property names can be converted in both directions without allocating
+ *  new strings or calculating new hashes.
+ *
+ *  The table is bounded: when it is full, the name that was used the
+ *  longest time ago is evicted, so that dynamic keys (like ids) do not
+ *  push out the names that show up later. Very long names are simply
+ *  converted the regular way. The PHP strings are regular refcounted
+ *  persistent strings, so they stay valid for as long as PHP uses them,
+ *  also after they were evicted from the table.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+#include <list>
+#include <unordered_map>
+
+/**
+ *  Forward declarations
+ */
+struct _zend_string;
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class Interned
+{
+private:
+    /**
+     *  Structure that links the javascript and PHP strings
+     */
+    struct Entry
+    {
+        /**
+         *  The internalized javascript string
+         *  @var v8::Global<v8::String>
+         */
+        v8::Global<v8::String> string;
+
+        /**
+         *  The identity hash of the javascript string
+         *  @var int
+         */
+        int hash;
+
+        /**
+         *  The persistent PHP string (we hold a reference to it)
+         *  @var zend_string
+         */
+        struct _zend_string *name;
+    };
+
+    /**
+     *  Max number of entries, and max length of a name that is interned
+     *  @var size_t
+     */
+    static constexpr size_t capacity = 4096;
+    static constexpr size_t maxlength = 128;
+
+    /**
+     *  All entries, the most recently used entry comes first
+     *  @var std::list<Entry>
+     */
+    static std::list<Entry> _entries;
+
+    /**
+     *  Index of the entries by the hash of the javascript string
+     *  @var std::unordered_multimap
+     */
+    static std::unordered_multimap<int, std::list<Entry>::iterator> _jsindex;
+
+    /**
+     *  Index of the entries by the hash of the PHP string
+     *  @var std::unordered_multimap
+     */
+    static std::unordered_multimap<uint64_t, std::list<Entry>::iterator> _phpindex;
+
+    /**
+     *  Mark an entry as the most recently used one
+     *  @param  entry       the entry
+     */
+    static void touch(std::list<Entry>::iterator entry);
+
+    /**
+     *  Remove the entry that was used the longest time ago
+     */
+    static void evict();
+
+    /**
+     *  Add an entry to the table
+     *  @param  isolate     the isolate
+     *  @param  string      the internalized javascript string
+     *  @param  data        the characters
+     *  @param  size        number of bytes
+     *  @return zend_string the persistent PHP string
+     */
+    static struct _zend_string *add(v8::Isolate *isolate, const v8::Local<v8::String> &string, const char *data, size_t size);
+
+public:
+    /**
+     *  Convert a javascript property name to a PHP string
+     *  @param  isolate     the isolate
+     *  @param  name        the javascript name (must be a string)
+     *  @return Php::Value
+     */
+    static Php::Value php(v8::Isolate *isolate, const v8::Local<v8::Name> &name);
+
+    /**
+     *  Convert a PHP property name to a javascript string
+     *  @param  isolate     the isolate
+     *  @param  name        the PHP name
+     *  @return v8::Local<v8::String>
+     */
+    static v8::Local<v8::String> js(v8::Isolate *isolate, const Php::Value &name);
+
+    /**
+     *  Forget all entries (must be called before the isolate is disposed)
+     */
+    static void reset();
+
+    /**
+     *  Release all resources (called when the extension is unloaded)
+     */
+    static void shutdown();
+};
+
+/**
+ *  End of namespace
+ */
+}
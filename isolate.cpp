@@ -31,9 +31,9 @@ v8::Isolate *Isolate::_isolate;
 
 /**
  *  Templates for wrapping objects
- *  @var std::vector
+ *  @var std::deque
  */
-std::vector<Template> Isolate::_templates;
+std::deque<Template> Isolate::_templates;
 
 /**
  *  Total number of instances
@@ -23,8 +23,17 @@
  *  Dependencies
  */
 #include <v8.h>
+#include <v8-cppgc.h>
 #include "template.h"
 #include "platform.h"
+#include "interned.h"
+#include "arraymethods.h"
+#include "fromiterator.h"
+#include "templatecache.h"
+#include "allocator.h"
+#include "zendvalue.h"
+#include <deque>
+#include <algorithm>
 
 /**
  *  Start namespace
@@ -61,10 +70,10 @@ private:
     static v8::Isolate *_isolate;
 
     /**
-     *  Templates for wrapping objects
-     *  @var std::vector
+     *  Templates for wrapping objects (a deque, because the template cache holds pointers to them)
+     *  @var std::deque
      */
-    static std::vector<Template> _templates;
+    static std::deque<Template> _templates;
     
     /**
      *  Total number of instances
@@ -82,8 +91,11 @@ public:
         // do we already have an isolate
         if (_instances++ != 0) return;
         
-        // we need an allocator
-        _params.array_buffer_allocator = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+        // we need an allocator, with an optional limit on the memory for array buffers
+        _params.array_buffer_allocator = new Allocator(std::max(Php::ini_get("js.buffer_limit").numericValue(), int64_t(0)));
+        
+        // wrappers can be managed by the C++ heap of v8 (the isolate takes ownership of the heap)
+        _params.cpp_heap = Php::ini_get("js.cppgc_wrappers") ? v8::CppHeap::Create(_platform->platform(), v8::CppHeapCreateParams({})).release() : nullptr;
         
         // construct the isolate
         _isolate = v8::Isolate::New(_params);
@@ -103,8 +115,12 @@ public:
         // was this the last reference
         if (--_instances != 0) return;
 
-        // remove the templates first before we dispose the isolate
+        // remove the templates and interned strings first before we dispose the isolate
+        TemplateCache::reset();
         _templates.clear();
+        Interned::reset();
+        ArrayMethods::reset();
+        FromIterator::reset();
         
         // free up the isolate
         _isolate->Dispose();
@@ -119,6 +135,33 @@ public:
      *  @return Template
      */
     const Template &prototype(const Php::Value &object)
+    {
+        // arrays have no class, so the templates are checked
+        if (!object.isObject()) return find(object);
+        
+        // the class of the object
+        auto *ce = Z_OBJCE_P(ZendValue::get(object));
+        
+        // the template only depends on the class, so it may be cached
+        auto *cached = TemplateCache::find(ce);
+        if (cached != nullptr) return *cached;
+        
+        // look for the template
+        const Template &result = find(object);
+        
+        // remember it for the next object of this class
+        TemplateCache::store(ce, &result);
+        
+        // expose the template
+        return result;
+    }
+
+    /**
+     *  Look for an appropriate template in the templates that we have
+     *  @param  object
+     *  @return Template
+     */
+    const Template &find(const Php::Value &object)
     {
         // check the prototypes that we have
         for (const auto &prototype : _templates)
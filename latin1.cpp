@@ -0,0 +1,343 @@
+/**
+ *  Latin1.cpp
+ *
+ *  Implementation file for the Latin1 class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "latin1.h"
+#include <cstring>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Scalar implementation of the ascii scan, eight bytes at a time
+ *  @param  data        the buffer
+ *  @param  size        size of the buffer
+ *  @return size_t
+ */
+static size_t ascii_scalar(const char *data, size_t size)
+{
+    // process eight bytes at a time
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        // load the bytes (memcpy because the data does not have to be aligned)
+        uint64_t word; memcpy(&word, data + i, 8);
+
+        // stop at the first word with a high bit
+        if (word & 0x8080808080808080ULL) break;
+    }
+
+    // find the exact position in the remaining bytes
+    while (i < size && static_cast<unsigned char>(data[i]) < 0x80) ++i;
+
+    // done
+    return i;
+}
+
+/**
+ *  Scalar implementation of the count of non-ascii bytes, eight bytes at a time
+ *  @param  data        the buffer
+ *  @param  size        size of the buffer
+ *  @return size_t
+ */
+static size_t count_scalar(const char *data, size_t size)
+{
+    // the number of bytes found
+    size_t result = 0;
+
+    // process eight bytes at a time
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        // load the bytes (memcpy because the data does not have to be aligned)
+        uint64_t word; memcpy(&word, data + i, 8);
+
+        // count the high bits
+        result += __builtin_popcountll(word & 0x8080808080808080ULL);
+    }
+
+    // count the remaining bytes
+    for (; i < size; ++i) result += static_cast<unsigned char>(data[i]) >> 7;
+
+    // done
+    return result;
+}
+
+/**
+ *  The kernels that are picked for this cpu
+ */
+struct Kernels
+{
+    /**
+     *  Number of ascii characters at the start of a buffer
+     *  @var function pointer
+     */
+    size_t (*ascii)(const char *, size_t);
+
+    /**
+     *  Number of non-ascii bytes in a buffer
+     *  @var function pointer
+     */
+    size_t (*count)(const char *, size_t);
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/**
+ *  SSE2 implementation of the ascii scan, sixteen bytes at a time
+ *  @param  data        the buffer
+ *  @param  size        size of the buffer
+ *  @return size_t
+ */
+__attribute__((target("sse2")))
+static size_t ascii_sse2(const char *data, size_t size)
+{
+    // process sixteen bytes at a time
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        // the high bits of all bytes
+        int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)));
+
+        // if one of them was set, we found the first non-ascii byte
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+
+    // process the remaining bytes
+    return i + ascii_scalar(data + i, size - i);
+}
+
+/**
+ *  AVX2 implementation of the ascii scan, thirty-two bytes at a time
+ *  @param  data        the buffer
+ *  @param  size        size of the buffer
+ *  @return size_t
+ */
+__attribute__((target("avx2")))
+static size_t ascii_avx2(const char *data, size_t size)
+{
+    // process thirty-two bytes at a time
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        // the high bits of all bytes
+        unsigned mask = _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i)));
+
+        // if one of them was set, we found the first non-ascii byte
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+
+    // process the remaining bytes
+    return i + ascii_sse2(data + i, size - i);
+}
+
+/**
+ *  SSE2 implementation of the count of non-ascii bytes, sixteen bytes at a time
+ *  @param  data        the buffer
+ *  @param  size        size of the buffer
+ *  @return size_t
+ */
+__attribute__((target("sse2,popcnt")))
+static size_t count_sse2(const char *data, size_t size)
+{
+    // the number of bytes found
+    size_t result = 0;
+
+    // process sixteen bytes at a time
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        // count the high bits of all bytes
+        result += __builtin_popcount(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i))));
+    }
+
+    // process the remaining bytes
+    return result + count_scalar(data + i, size - i);
+}
+
+/**
+ *  AVX2 implementation of the count of non-ascii bytes, thirty-two bytes at a time
+ *  @param  data        the buffer
+ *  @param  size        size of the buffer
+ *  @return size_t
+ */
+__attribute__((target("avx2,popcnt")))
+static size_t count_avx2(const char *data, size_t size)
+{
+    // the number of bytes found
+    size_t result = 0;
+
+    // process thirty-two bytes at a time
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        // count the high bits of all bytes
+        result += __builtin_popcount(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i))));
+    }
+
+    // process the remaining bytes
+    return result + count_sse2(data + i, size - i);
+}
+
+/**
+ *  Pick the best kernels for this cpu
+ *  @return Kernels
+ */
+static Kernels select()
+{
+    // this runs before the constructors, so the cpu information has to be initialized first
+    __builtin_cpu_init();
+
+    // the population count instruction is not part of SSE2, so it is checked separately
+    bool popcnt = __builtin_cpu_supports("popcnt");
+
+    // check what the cpu supports
+    if (__builtin_cpu_supports("avx2") && popcnt) return { ascii_avx2, count_avx2 };
+    if (__builtin_cpu_supports("sse2") && popcnt) return { ascii_sse2, count_sse2 };
+    if (__builtin_cpu_supports("sse2")) return { ascii_sse2, count_scalar };
+
+    // fall back to the scalar implementations
+    return { ascii_scalar, count_scalar };
+}
+
+#else
+
+/**
+ *  Pick the best kernels for this cpu
+ *  @return Kernels
+ */
+static Kernels select()
+{
+    // only the scalar implementations are available
+    return { ascii_scalar, count_scalar };
+}
+
+#endif
+
+/**
+ *  The kernels that are used
+ *  @var Kernels
+ */
+static const Kernels kernels = select();
+
+/**
+ *  Number of ascii characters at the start of a buffer
+ *  @param  data        the buffer
+ *  @param  size        size of the buffer
+ *  @return size_t      equal to size if the entire buffer is ascii
+ */
+size_t Latin1::ascii(const char *data, size_t size)
+{
+    // pass on to the implementation
+    return kernels.ascii(data, size);
+}
+
+/**
+ *  Convert utf-8 into latin-1
+ *  @param  data        the utf-8 input
+ *  @param  size        size of the input
+ *  @param  output      buffer of at least size bytes
+ *  @return size_t      number of bytes written, or SIZE_MAX if the input contains characters that are not in latin-1
+ */
+size_t Latin1::decode(const char *data, size_t size, uint8_t *output)
+{
+    // number of bytes written
+    size_t written = 0;
+
+    // process the input
+    for (size_t i = 0; i < size; )
+    {
+        // skip over a run of ascii characters in one go
+        size_t run = ascii(data + i, size - i);
+        memcpy(output + written, data + i, run);
+
+        // update the positions
+        i += run; written += run;
+
+        // are we done?
+        if (i == size) break;
+
+        // latin-1 characters above ascii are encoded as 0xC2 or 0xC3, followed by a continuation byte
+        unsigned char lead = data[i];
+        if ((lead != 0xC2 && lead != 0xC3) || i + 1 == size) return SIZE_MAX;
+
+        // check the continuation byte
+        unsigned char next = data[i + 1];
+        if ((next & 0xC0) != 0x80) return SIZE_MAX;
+
+        // decode the character
+        output[written++] = ((lead & 0x03) << 6) | (next & 0x3F);
+
+        // skip the two bytes
+        i += 2;
+    }
+
+    // done
+    return written;
+}
+
+/**
+ *  Number of bytes that are needed to encode a latin-1 buffer in utf-8
+ *  @param  data        the latin-1 buffer
+ *  @param  size        size of the buffer
+ *  @return size_t
+ */
+size_t Latin1::utf8length(const char *data, size_t size)
+{
+    // every non-ascii character takes two bytes
+    return size + kernels.count(data, size);
+}
+
+/**
+ *  Convert latin-1 into utf-8
+ *  @param  data        the latin-1 input
+ *  @param  size        size of the input
+ *  @param  output      buffer of at least utf8length(data, size) bytes
+ *  @return size_t      number of bytes written
+ */
+size_t Latin1::encode(const char *data, size_t size, char *output)
+{
+    // number of bytes written
+    size_t written = 0;
+
+    // process the input
+    for (size_t i = 0; i < size; )
+    {
+        // copy a run of ascii characters in one go
+        size_t run = ascii(data + i, size - i);
+        memcpy(output + written, data + i, run);
+
+        // update the positions
+        i += run; written += run;
+
+        // are we done?
+        if (i == size) break;
+
+        // the other characters are encoded as 0xC2 or 0xC3, followed by a continuation byte
+        unsigned char character = data[i++];
+        output[written++] = 0xC0 | (character >> 6);
+        output[written++] = 0x80 | (character & 0x3F);
+    }
+
+    // done
+    return written;
+}
+
+/**
+ *  End of namespace
+ */
+}
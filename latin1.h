@@ -0,0 +1,75 @@
+/**
+ *  Latin1.h
+ *
+ *  Helper functions to quickly scan and convert strings between utf-8 (the
+ *  encoding that PHP uses) and latin-1 (the encoding of the one-byte strings
+ *  in v8), in both directions. Most strings are plain ascii, which is the
+ *  same in both encodings, so the scans over the bytes are vectorized: with
+ *  AVX2 when the cpu supports it, with SSE2 otherwise, and with a scalar
+ *  fallback on other architectures.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <cstddef>
+#include <cstdint>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class Latin1
+{
+public:
+    /**
+     *  Number of ascii characters at the start of a buffer
+     *  @param  data        the buffer
+     *  @param  size        size of the buffer
+     *  @return size_t      equal to size if the entire buffer is ascii
+     */
+    static size_t ascii(const char *data, size_t size);
+
+    /**
+     *  Convert utf-8 into latin-1
+     *  @param  data        the utf-8 input
+     *  @param  size        size of the input
+     *  @param  output      buffer of at least size bytes
+     *  @return size_t      number of bytes written, or SIZE_MAX if the input contains characters that are not in latin-1
+     */
+    static size_t decode(const char *data, size_t size, uint8_t *output);
+
+    /**
+     *  Number of bytes that are needed to encode a latin-1 buffer in utf-8
+     *  @param  data        the latin-1 buffer
+     *  @param  size        size of the buffer
+     *  @return size_t
+     */
+    static size_t utf8length(const char *data, size_t size);
+
+    /**
+     *  Convert latin-1 into utf-8
+     *  @param  data        the latin-1 input
+     *  @param  size        size of the input
+     *  @param  output      buffer of at least utf8length(data, size) bytes
+     *  @return size_t      number of bytes written
+     */
+    static size_t encode(const char *data, size_t size, char *output);
+};
+
+/**
+ *  End of namespace
+ */
+}
@@ -0,0 +1,179 @@
+/**
+ *  Link.cpp
+ * 
+ *  Implementation file for the Link class
+ * 
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "link.h"
+#include "zendvalue.h"
+#include "core.h"
+#include <memory>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Links of which the object was garbage collected, and that still have to be deleted
+ *  @var std::vector<Link*>
+ */
+std::vector<Link *> Link::_collected;
+
+/**
+ *  Number of links that are alive
+ *  @var size_t
+ */
+size_t Link::_live = 0;
+
+/**
+ *  Memory for one link, when it is not in use it is part of the free list
+ */
+union Slot
+{
+    /**
+     *  The next free slot
+     *  @var Slot
+     */
+    Slot *next;
+
+    /**
+     *  Room for the link
+     *  @var char[]
+     */
+    alignas(Link) char data[sizeof(Link)];
+};
+
+/**
+ *  Number of links in one block
+ *  @var size_t
+ */
+static constexpr size_t blocksize = 256;
+
+/**
+ *  All blocks that were allocated (they are never released, but their slots are reused)
+ *  @var std::vector
+ */
+static std::vector<std::unique_ptr<Slot[]>> blocks;
+
+/**
+ *  The free slots
+ *  @var Slot
+ */
+static Slot *available = nullptr;
+
+/**
+ *  Links are allocated from blocks of memory
+ *  @param  size
+ *  @return void*
+ */
+void *Link::operator new(size_t size)
+{
+    // if the free list is empty, we allocate a new block
+    if (available == nullptr)
+    {
+        // allocate the block
+        blocks.emplace_back(new Slot[blocksize]);
+
+        // add all its slots to the free list
+        for (size_t i = 0; i < blocksize; ++i) blocks.back()[i].next = i + 1 < blocksize ? &blocks.back()[i + 1] : nullptr;
+
+        // the new slots are available
+        available = &blocks.back()[0];
+    }
+
+    // take the first slot from the free list
+    Slot *slot = available;
+    available = slot->next;
+
+    // one more link alive
+    ++_live;
+
+    // expose the memory
+    return slot;
+}
+
+/**
+ *  Return the memory of a link to the free list
+ *  @param  pointer
+ */
+void Link::operator delete(void *pointer)
+{
+    // put the slot back on the free list
+    Slot *slot = static_cast<Slot *>(pointer);
+    slot->next = available;
+    available = slot;
+
+    // one link less
+    --_live;
+}
+
+/**
+ *  Estimate the amount of memory that is used by a PHP variable
+ *  @param  value
+ *  @param  core        the context, which holds the number of bytes per element
+ *  @return int64_t
+ */
+int64_t Link::estimate(const Php::Value &value, const Core *core)
+{
+    // without a context there is nothing to report
+    if (core == nullptr) return 0;
+
+    // the underlying zval
+    zval *zv = ZendValue::get(value);
+
+    // only arrays and objects are worth reporting
+    if (Z_TYPE_P(zv) != IS_ARRAY && Z_TYPE_P(zv) != IS_OBJECT) return 0;
+
+    // the number of bytes per element (zero to disable the accounting)
+    int64_t factor = core->factor();
+    if (factor <= 0) return 0;
+
+    // arrays are estimated by the number of elements
+    if (Z_TYPE_P(zv) == IS_ARRAY) return factor * zend_hash_num_elements(Z_ARRVAL_P(zv));
+
+    // objects by their properties, once the property table exists it holds the declared properties too
+    zend_object *object = Z_OBJ_P(zv);
+    return factor * (object->properties ? zend_hash_num_elements(object->properties) : object->ce->default_properties_count);
+}
+
+/**
+ *  Called by v8 when the object is garbage collected
+ *  @param  info
+ */
+void Link::collect(const v8::WeakCallbackInfo<Link> &info)
+{
+    // get the original object
+    Link *self = info.GetParameter();
+
+    // the handle must be reset in this first pass
+    self->_object.Reset();
+
+    // releasing the PHP value may run PHP code, which is not allowed during the garbage
+    // collection, so we remember the link, and delete it later
+    _collected.push_back(self);
+}
+
+/**
+ *  Delete the links that were garbage collected
+ */
+void Link::purge()
+{
+    // take over the links (deleting them could trigger a new garbage collection)
+    std::vector<Link *> collected;
+    collected.swap(_collected);
+
+    // delete all links
+    for (auto *link : collected) delete link;
+}
+
+/**
+ *  End of namespace
+ */
+}
@@ -4,8 +4,20 @@
  *  Class that makes sure that an associated Php::Value object is 
  *  destructed when it falls out of scope
  * 
+ *  Scripts that touch many PHP objects create many links, so they are
+ *  allocated from blocks of memory with a free list (instead of one heap
+ *  allocation each). The PHP values of the links that were garbage
+ *  collected cannot be released during the garbage collection (this could
+ *  run PHP code), so they are released in a single batch later on: when
+ *  the next link is created, and at the end of the request.
+ *
+ *  v8 does not know how much PHP memory is kept alive by the links, so an
+ *  estimate is reported as external memory (the number of elements or
+ *  properties times the "js.external_memory_factor" setting), to make sure
+ *  that the garbage collector runs often enough.
+ * 
  *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
- *  @copyright 2025 Copernica BV
+ *  @copyright 2025 - 2026 Copernica BV
  */
 
 /**
@@ -13,6 +25,14 @@
  */
 #pragma once
 
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+#include "holder.h"
+#include <vector>
+
 /**
  *  Begin of namespace
  */
@@ -21,9 +41,15 @@ namespace JS {
 /**
  *  Class definition
  */
-class Link
+class Link : public Holder
 {
 private:
+    /**
+     *  The isolate
+     *  @var v8::Isolate
+     */
+    v8::Isolate *_isolate;
+
     /**
      *  The object to which the deleter is linked
      *  This is a global object because it must stay in scope for as long as the object is not yet destructed,
@@ -44,7 +70,29 @@ private:
      */
     bool _weak = false;
     
+    /**
+     *  The estimated size of the PHP variable that was reported to v8
+     *  @var int64_t
+     */
+    int64_t _size;
+    
+    /**
+     *  Links of which the object was garbage collected, and that still have to be deleted
+     *  @var std::vector<Link*>
+     */
+    static std::vector<Link *> _collected;
+    
+    /**
+     *  Number of links that are alive
+     *  @var size_t
+     */
+    static size_t _live;
     
+    /**
+     *  Called by v8 when the object is garbage collected
+     *  @param  info
+     */
+    static void collect(const v8::WeakCallbackInfo<Link> &info);
     
 public:
     /**
@@ -55,20 +103,21 @@ public:
      *  @param  weak
      */
     Link(v8::Isolate *isolate, const v8::Local<v8::Object> &object, const Php::Value &value, bool weak) : 
+        Holder(isolate),
+        _isolate(isolate),
         _object(isolate, object), 
         _value(weak ? Php::call("WeakReference::create", value) : value),
-        _weak(weak)
+        _weak(weak),
+        _size(weak ? 0 : estimate(value, core()))
     {
-        // install a function that will be called when the object is garbage collected
-        _object.SetWeak<Link>(this, [](const v8::WeakCallbackInfo<Link> &info) {
-            
-            // get the original object
-            Link *self = info.GetParameter();
-            
-            // do the self-destruction
-            delete self;
+        // this is a good moment to get rid of the links that were garbage collected before
+        purge();
 
-        }, v8::WeakCallbackType::kParameter);
+        // install a function that will be called when the object is garbage collected
+        _object.SetWeak<Link>(this, &Link::collect, v8::WeakCallbackType::kParameter);
+        
+        // tell v8 how much memory is kept alive by the object
+        if (_size > 0) isolate->AdjustAmountOfExternalAllocatedMemory(_size);
     }
     
     /**
@@ -84,8 +133,56 @@ public:
     {
         // remove the persistent object, this will
         _object.Reset();
+        
+        // the memory is no longer kept alive by the object
+        if (_size > 0) _isolate->AdjustAmountOfExternalAllocatedMemory(-_size);
     }
     
+    /**
+     *  Release the PHP variable (when the context is disposed)
+     */
+    virtual void release() override
+    {
+        // the memory is no longer kept alive by the object
+        if (_size > 0) _isolate->AdjustAmountOfExternalAllocatedMemory(-_size);
+        _size = 0;
+
+        // forget the variable
+        _value = nullptr;
+    }
+    
+    /**
+     *  Links are allocated from blocks of memory
+     *  @param  size
+     *  @return void*
+     */
+    static void *operator new(size_t size);
+    
+    /**
+     *  Return the memory of a link to the free list
+     *  @param  pointer
+     */
+    static void operator delete(void *pointer);
+    
+    /**
+     *  Number of links that are alive
+     *  @return size_t
+     */
+    static size_t live() { return _live; }
+    
+    /**
+     *  Delete the links that were garbage collected
+     */
+    static void purge();
+    
+    /**
+     *  Estimate the amount of memory that is used by a PHP variable
+     *  @param  value
+     *  @param  core        the context, which holds the number of bytes per element
+     *  @return int64_t
+     */
+    static int64_t estimate(const Php::Value &value, const Core *core);
+    
     /**
      *  Get the value
      *  @return Php::Value
@@ -12,6 +12,7 @@
  */
 #include "linker.h"
 #include "link.h"
+#include "wrapper.h"
 #include "core.h"
 
 /**
@@ -25,7 +26,44 @@ namespace JS {
  *  @param  object      the javascript object to be linked
  */
 Linker::Linker(v8::Isolate *isolate, const v8::Local<v8::Object> &object) :
-    _isolate(isolate), _key(v8::Private::ForApi(isolate, v8::String::NewFromUtf8Literal(isolate, "php-js.linker"))), _object(object) {}
+    _isolate(isolate), _object(object) {}
+
+/**
+ *  Does the object have internal fields for the link?
+ *  @return bool
+ */
+bool Linker::internal() const
+{
+    // other objects with internal fields (like our iterators) have a different number of fields
+    return _object->InternalFieldCount() == fields;
+}
+
+/**
+ *  The private symbol for objects without internal fields
+ *  @return v8::Local<v8::Private>
+ */
+v8::Local<v8::Private> Linker::key() const
+{
+    // the symbol is registered in the isolate, so this always returns the same symbol
+    return v8::Private::ForApi(_isolate, v8::String::NewFromUtf8Literal(_isolate, "php-js.linker"));
+}
+
+/**
+ *  What is stored in the internal fields?
+ *  @return Kind
+ */
+Linker::Kind Linker::kind() const
+{
+    // only objects from our own templates have the fields
+    if (!internal()) return Kind::Empty;
+
+    // the first field holds the kind (the fields are undefined until the object is linked)
+    auto kind = _object->GetInternalField(0);
+    if (!kind->IsValue() || !kind.As<v8::Value>()->IsInt32()) return Kind::Empty;
+
+    // expose the kind
+    return static_cast<Kind>(kind.As<v8::Int32>()->Value());
+}
 
 /**
  *  Get the internal pointer
@@ -33,8 +71,11 @@ Linker::Linker(v8::Isolate *isolate, const v8::Local<v8::Object> &object) :
  */
 Link *Linker::pointer() const
 {
+    // objects from our own templates store the link in an internal field
+    if (internal()) return kind() == Kind::Linked ? static_cast<Link*>(_object->GetAlignedPointerFromInternalField(1)) : nullptr;
+
     // check if the private propery exists
-    v8::MaybeLocal<v8::Value> property = _object->GetPrivate(_isolate->GetCurrentContext(), _key);
+    v8::MaybeLocal<v8::Value> property = _object->GetPrivate(_isolate->GetCurrentContext(), key());
     
     // if not set, or if not a pointer to an external thing
     if (property.IsEmpty()) return nullptr;
@@ -56,7 +97,7 @@ Link *Linker::pointer() const
 bool Linker::valid() const
 {
     // check the pointer
-    return pointer() != nullptr;
+    return kind() == Kind::Wrapped || pointer() != nullptr;
 }
 
 /**
@@ -73,18 +114,50 @@ const Php::Value &Linker::attach(const Php::Value &value, bool weak)
     // make a brand new link
     auto *link = new Link(_isolate, _object, value, weak);
     
-    // associate property
-    _object->SetPrivate(_isolate->GetCurrentContext(), _key, v8::External::New(_isolate, link));
+    // objects from our own templates store the link in the internal fields
+    if (internal())
+    {
+        // store the link, and mark that it is set
+        _object->SetAlignedPointerInInternalField(1, link);
+        _object->SetInternalField(0, v8::Integer::New(_isolate, Kind::Linked));
+    }
+
+    // other objects get a private property
+    else _object->SetPrivate(_isolate->GetCurrentContext(), key(), v8::External::New(_isolate, link));
     
     // done, expose the same value
     return value;
 }
 
+/**
+ *  Associate an object that was just created from one of our templates with a
+ *  PHP variable, the link is managed by the C++ heap of v8 when that is enabled
+ *  @param  value
+ *  @return Php::Value
+ */
+const Php::Value &Linker::wrap(const Php::Value &value)
+{
+    // without a C++ heap we use a regular link
+    if (_isolate->GetCppHeap() == nullptr || !internal()) return attach(value, false);
+
+    // let the object point to a wrapper on the C++ heap
+    Wrapper::wrap(_isolate, _object, value);
+
+    // mark that the object is wrapped
+    _object->SetInternalField(0, v8::Integer::New(_isolate, Kind::Wrapped));
+
+    // done, expose the same value
+    return value;
+}
+
 /**
  *  Detach the PHP object from the javascript object
  */
 void Linker::detach()
 {
+    // a wrapper cannot be removed, but it can be ignored (it is collected together with the object)
+    if (kind() == Kind::Wrapped) { _object->SetInternalField(0, v8::Integer::New(_isolate, Kind::Empty)); return; }
+
     // get the link pointer
     Link *link = pointer();
     
@@ -94,8 +167,11 @@ void Linker::detach()
     // remove the link
     delete link;
     
-    // remove private property
-    _object->DeletePrivate(_isolate->GetCurrentContext(), _key);
+    // mark the internal field as empty
+    if (internal()) _object->SetInternalField(0, v8::Integer::New(_isolate, Kind::Empty));
+
+    // or remove the private property
+    else _object->DeletePrivate(_isolate->GetCurrentContext(), key());
 }
 
 /**
@@ -104,6 +180,9 @@ void Linker::detach()
  */
 Php::Value Linker::value() const
 {
+    // objects that are wrapped by the C++ heap
+    if (kind() == Kind::Wrapped) return Wrapper::unwrap(_isolate, _object)->value();
+
     // get the link pointer
     Link *link = pointer();
     
@@ -7,6 +7,11 @@
  * 
  *  It also makes sure that once the javascript object is destructed,
  *  the associated PHP object is destructed too.
+ *
+ *  Objects that are created from our own templates have internal fields
+ *  to store the link, so that it can be found without a property lookup.
+ *  Other objects (like the ones that are created by scripts and that are
+ *  returned to PHP) use a private property instead.
  * 
  *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
  *  @copyright 2025 Copernica BV
@@ -45,25 +50,53 @@ private:
      */
     v8::Isolate *_isolate;
 
-    /**
-     *  The private symbol for lookups of the external pointer
-     *  @var v8::Local<v8::Private>
-     */
-    v8::Local<v8::Private> _key;
-
     /**
      *  The underlying object
      *  @var v8::Local<v8::Object>
      */
     v8::Local<v8::Object> _object;
     
+    /**
+     *  What is stored in the internal fields of objects from our own templates
+     */
+    enum Kind : int32_t {
+        Empty   =   0,
+        Linked  =   1,
+        Wrapped =   2
+    };
+
     /**
      *  Helper function to get access to the pointer to the Php::Value
      *  @return Link
      */
     Link *pointer() const;
 
+    /**
+     *  What is stored in the internal fields?
+     *  @return Kind
+     */
+    Kind kind() const;
+
+    /**
+     *  Does the object have internal fields for the link?
+     *  @return bool
+     */
+    bool internal() const;
+
+    /**
+     *  The private symbol for objects without internal fields
+     *  @return v8::Local<v8::Private>
+     */
+    v8::Local<v8::Private> key() const;
+
 public:
+    /**
+     *  Number of internal fields that templates should reserve for the link
+     *  (the first one tells what is stored, the second one holds the link)
+     *  @var int
+     */
+    static constexpr int fields = 2;
+
     /**
      *  Constructor
      *  @param  isolate     the active isolate
@@ -96,6 +129,14 @@ public:
      */
     const Php::Value &attach(const Php::Value &value, bool weak = false);
     
+    /**
+     *  Associate an object that was just created from one of our templates with a
+     *  PHP variable, the link is managed by the C++ heap of v8 when that is enabled
+     *  @param  value
+     *  @return Php::Value
+     */
+    const Php::Value &wrap(const Php::Value &value);
+    
     /**
      *  Detach the PHP object from the javascript object
      */
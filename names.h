@@ -26,12 +26,22 @@ struct Names {
     inline static const char *Object = "JS\\Object";
     inline static const char *Context = "JS\\Context";
     inline static const char *Function = "JS\\Function";
+    inline static const char *Array = "JS\\Array";
+    inline static const char *Buffer = "JS\\Buffer";
+    inline static const char *Iterator = "JS\\Iterator";
     
     // constants
     inline static const char *None = "JS\\None";
     inline static const char *ReadOnly = "JS\\ReadOnly";
     inline static const char *DontDelete = "JS\\DontDelete";
     inline static const char *DontEnumerate = "JS\\DontEnumerate";
+    inline static const char *Proxy = "JS\\Proxy";
+    inline static const char *Copy = "JS\\Copy";
+    inline static const char *Auto = "JS\\Auto";
+    inline static const char *AsRows = "JS\\AsRows";
+    inline static const char *AsJson = "JS\\AsJson";
+    inline static const char *Float64 = "JS\\Float64";
+    inline static const char *Int32 = "JS\\Int32";
     
     
 };
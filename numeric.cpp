@@ -0,0 +1,265 @@
+/**
+ *  Numeric.cpp
+ *
+ *  Implementation file for the Numeric class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "numeric.h"
+#include "zendvalue.h"
+#include "allocator.h"
+#include <type_traits>
+#include <algorithm>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Helper function to convert a PHP value into an element of a typed array
+ *  @param  value       the PHP value
+ *  @return T
+ */
+template <typename T>
+static T element(zval *value)
+{
+    // floating point numbers
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        // numbers can be used right away, other values are converted the PHP way
+        switch (Z_TYPE_P(value)) {
+        case IS_DOUBLE: return Z_DVAL_P(value);
+        case IS_LONG:   return Z_LVAL_P(value);
+        default:        return zval_get_double(value);
+        }
+    }
+    else
+    {
+        // numbers can be used right away, other values are converted the PHP way (the
+        // result is truncated to the size of the element, like javascript does too)
+        switch (Z_TYPE_P(value)) {
+        case IS_LONG:   return static_cast<T>(Z_LVAL_P(value));
+        case IS_DOUBLE: return static_cast<T>(zend_dval_to_lval(Z_DVAL_P(value)));
+        default:        return static_cast<T>(zval_get_long(value));
+        }
+    }
+}
+
+/**
+ *  Helper function to create a typed array with the values of a hashtable
+ *  @param  isolate     the isolate
+ *  @param  table       the hashtable
+ *  @return v8::Local<ArrayType>
+ */
+template <typename ArrayType, typename T>
+static v8::Local<ArrayType> create(v8::Isolate *isolate, HashTable *table)
+{
+    // number of elements
+    uint32_t size = zend_hash_num_elements(table);
+
+    // create the buffer (all elements are overwritten, so it does not have to be initialized)
+    auto buffer = Allocator::buffer(isolate, size * sizeof(T));
+
+    // the elements are written straight into the buffer
+    T *output = static_cast<T *>(buffer->Data());
+
+    // iterate over the hashtable
+    zval *value;
+    ZEND_HASH_FOREACH_VAL(table, value)
+    {
+        // the array may hold references
+        ZVAL_DEREF(value);
+
+        // store the element
+        *output++ = element<T>(value);
+    }
+    ZEND_HASH_FOREACH_END();
+
+    // create the typed array
+    return ArrayType::New(buffer, 0, size);
+}
+
+/**
+ *  Create a typed array with the values of a PHP array
+ *  @param  isolate     the isolate
+ *  @param  list        the PHP array (the keys are ignored)
+ *  @param  type        the type of the typed array
+ *  @return v8::Local<v8::Value>
+ *  @throws Php::Exception
+ */
+v8::Local<v8::Value> Numeric::create(v8::Isolate *isolate, const Php::Value &list, const Php::Value &type)
+{
+    // the values must be passed as array (PHP does not enforce the parameter type)
+    if (!list.isArray()) throw Php::Exception("Numeric values must be passed as array");
+
+    // the hashtable with the values
+    HashTable *table = Z_ARRVAL_P(ZendValue::get(list));
+
+    // check the type
+    switch (type.isNull() ? Float64 : type.numericValue()) {
+    case Float64:   return JS::create<v8::Float64Array, double>(isolate, table);
+    case Int32:     return JS::create<v8::Int32Array, int32_t>(isolate, table);
+    default:        throw Php::Exception("Invalid numeric type, use JS\\Float64 or JS\\Int32");
+    }
+}
+
+/**
+ *  Helper function to convert the elements of a typed array into a PHP array
+ *  @param  data        pointer to the first element
+ *  @param  size        number of elements
+ *  @return Php::Value
+ */
+template <typename T>
+static Php::Value convert(const void *data, size_t size)
+{
+    // the elements
+    const T *values = static_cast<const T *>(data);
+
+    // create the PHP array
+    Php::Value result = ZendValue::array(size);
+
+    // the underlying hashtable is filled as a packed array
+    HashTable *table = Z_ARRVAL_P(ZendValue::get(result));
+    zend_hash_real_init_packed(table);
+
+    // copy the elements
+    ZEND_HASH_FILL_PACKED(table)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            // store the element as float or integer
+            if constexpr (std::is_floating_point_v<T>) ZEND_HASH_FILL_SET_DOUBLE(values[i]);
+            else ZEND_HASH_FILL_SET_LONG(values[i]);
+
+            // next element
+            ZEND_HASH_FILL_NEXT();
+        }
+    }
+    ZEND_HASH_FILL_END();
+
+    // done
+    return result;
+}
+
+/**
+ *  Check if a value is a typed array with numbers that can be converted into a PHP array
+ *  @param  value       the javascript value
+ *  @return bool
+ */
+bool Numeric::supported(const v8::Local<v8::Value> &value)
+{
+    // Uint8Array holds binary data, and the 64-bit integer arrays hold BigInts
+    return value->IsFloat64Array() || value->IsFloat32Array() || value->IsInt32Array() || value->IsUint32Array() ||
+           value->IsInt16Array() || value->IsUint16Array() || value->IsInt8Array() || value->IsUint8ClampedArray();
+}
+
+/**
+ *  Convert a typed array with numbers into a PHP array
+ *  @param  array       the typed array (must be supported)
+ *  @return Php::Value
+ */
+Php::Value Numeric::array(const v8::Local<v8::TypedArray> &array)
+{
+    // number of elements
+    size_t size = array->Length();
+
+    // pointer to the first element (a detached buffer has no data)
+    const void *data = size == 0 ? nullptr : static_cast<const char *>(array->Buffer()->Data()) + array->ByteOffset();
+
+    // check the type of the elements
+    if (array->IsFloat64Array())        return convert<double>(data, size);
+    if (array->IsFloat32Array())        return convert<float>(data, size);
+    if (array->IsInt32Array())          return convert<int32_t>(data, size);
+    if (array->IsUint32Array())         return convert<uint32_t>(data, size);
+    if (array->IsInt16Array())          return convert<int16_t>(data, size);
+    if (array->IsUint16Array())         return convert<uint16_t>(data, size);
+    if (array->IsInt8Array())           return convert<int8_t>(data, size);
+    if (array->IsUint8ClampedArray())   return convert<uint8_t>(data, size);
+
+    // not supported
+    return nullptr;
+}
+
+/**
+ *  State that is passed to the callback when a javascript array is iterated
+ */
+struct Fill
+{
+    /**
+     *  The hashtable to fill
+     *  @var HashTable
+     */
+    HashTable *table;
+
+    /**
+     *  Number of elements copied
+     *  @var uint32_t
+     */
+    uint32_t count;
+};
+
+/**
+ *  Callback that is called for every element of a javascript array
+ *  @param  index       index of the element
+ *  @param  element     the element
+ *  @param  data        the state
+ *  @return v8::Array::CallbackResult
+ */
+static v8::Array::CallbackResult number(uint32_t index, v8::Local<v8::Value> element, void *data)
+{
+    // the state
+    auto *state = static_cast<Fill *>(data);
+
+    // convert the number (this callback may not call back into v8, so we stop at the first other value)
+    zval value;
+    if (element->IsInt32()) ZVAL_LONG(&value, element.As<v8::Int32>()->Value());
+    else if (element->IsNumber()) ZVAL_DOUBLE(&value, element.As<v8::Number>()->Value());
+    else return v8::Array::CallbackResult::kBreak;
+
+    // store the element
+    zend_hash_index_add_new(state->table, index, &value);
+
+    // the element was copied
+    state->count = index + 1;
+
+    // next element
+    return v8::Array::CallbackResult::kContinue;
+}
+
+/**
+ *  Copy the leading numbers of a javascript array into a PHP array
+ *  @param  context     the current context
+ *  @param  array       the javascript array
+ *  @param  output      the PHP array to fill
+ *  @return uint32_t    the number of elements that were copied
+ */
+uint32_t Numeric::fill(const v8::Local<v8::Context> &context, const v8::Local<v8::Array> &array, Php::Value &output)
+{
+    // the hashtable to fill
+    HashTable *table = Z_ARRVAL_P(ZendValue::get(output));
+
+    // make room for the elements (assuming that the array holds numbers only), but a
+    // sparse array can have a huge length, so beyond a certain size the table grows by itself
+    zend_hash_extend(table, std::min<uint32_t>(array->Length(), 65536), true);
+
+    // the state for the callback
+    Fill state{ table, 0 };
+
+    // iterate over the elements (v8 does this without looking up every index, the
+    // callback never reports an exception so the result does not have to be checked)
+    static_cast<void>(array->Iterate(context, &number, &state));
+
+    // done
+    return state.count;
+}
+
+/**
+ *  End of namespace
+ */
+}
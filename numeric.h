@@ -0,0 +1,80 @@
+/**
+ *  Numeric.h
+ *
+ *  Helper class to move large lists of numbers between PHP and javascript
+ *  in one pass. PHP lists are copied straight into the memory of a typed
+ *  array, and typed arrays and javascript arrays with numbers are copied
+ *  straight into the hashtable of a packed PHP array.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class Numeric
+{
+public:
+    /**
+     *  The supported types of typed arrays
+     */
+    enum Type {
+        Float64     =   0,
+        Int32       =   1
+    };
+
+    /**
+     *  Create a typed array with the values of a PHP array
+     *  @param  isolate     the isolate
+     *  @param  list        the PHP array (the keys are ignored)
+     *  @param  type        the type of the typed array
+     *  @return v8::Local<v8::Value>
+     *  @throws Php::Exception
+     */
+    static v8::Local<v8::Value> create(v8::Isolate *isolate, const Php::Value &list, const Php::Value &type);
+
+    /**
+     *  Check if a value is a typed array with numbers that can be converted into a PHP array
+     *  @param  value       the javascript value
+     *  @return bool
+     */
+    static bool supported(const v8::Local<v8::Value> &value);
+
+    /**
+     *  Convert a typed array with numbers into a PHP array
+     *  @param  array       the typed array (must be supported)
+     *  @return Php::Value
+     */
+    static Php::Value array(const v8::Local<v8::TypedArray> &array);
+
+    /**
+     *  Copy the leading numbers of a javascript array into a PHP array
+     *  @param  context     the current context
+     *  @param  array       the javascript array
+     *  @param  output      the PHP array to fill
+     *  @return uint32_t    the number of elements that were copied
+     */
+    static uint32_t fill(const v8::Local<v8::Context> &context, const v8::Local<v8::Array> &array, Php::Value &output);
+};
+
+/**
+ *  End of namespace
+ */
+}
@@ -17,6 +17,7 @@
  */
 #include "core.h"
 #include "php_variable.h"
+#include "numeric.h"
 
 /**
  *  Begin of namespace
@@ -39,8 +40,8 @@ public:
         // we need a context
         auto ctx = isolate->GetCurrentContext();
 
-        // iterate over the input array
-        for (uint32_t i = 0; i < input->Length(); ++i)
+        // leading numbers are copied in bulk, the rest is converted element by element
+        for (uint32_t i = Numeric::fill(ctx, input, *this); i < input->Length(); ++i)
         {
             // get item from the array
             v8::MaybeLocal<v8::Value> maybe = input->Get(ctx, i);
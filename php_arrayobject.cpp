@@ -0,0 +1,176 @@
+/**
+ *  PhpArrayObject.cpp
+ *
+ *  Implementation file for the PhpArrayObject class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "php_arrayobject.h"
+#include "scope.h"
+#include "fromphp.h"
+#include "php_variable.h"
+#include "php_iterator.h"
+#include "php_copy.h"
+#include "php_exception.h"
+
+/**
+ *  Start namespace
+ */
+namespace JS {
+
+/**
+ *  Helper method to convert a PHP key to a javascript key
+ *  @param  key
+ *  @return v8::Local<v8::Value>
+ */
+v8::Local<v8::Value> PhpArrayObject::key(const Php::Value &key) const
+{
+    // numeric keys are passed as numbers, others as strings
+    if (key.isNumeric()) return v8::Number::New(_core->isolate(), static_cast<double>(key.numericValue()));
+
+    // convert to a string
+    return FromPhp(_core->isolate(), key.clone(Php::Type::String));
+}
+
+/**
+ *  Check if an element exists
+ *  @param  key     The index
+ *  @return bool
+ */
+bool PhpArrayObject::offsetExists(const Php::Value &key)
+{
+    // scope for the call
+    Scope scope(_core);
+
+    // get the array in a local variable
+    v8::Local<v8::Array> array(_object.Get(_core->isolate()).As<v8::Array>());
+
+    // the element must exist, and it should not be undefined (to be consistent with isset())
+    v8::Local<v8::Value> element;
+    if (!array->Get(scope, this->key(key)).ToLocal(&element)) return false;
+
+    // check the value
+    return !element->IsUndefined() && !element->IsNull();
+}
+
+/**
+ *  Retrieve an element
+ *  @param  key     The index
+ *  @return Php::Value
+ */
+Php::Value PhpArrayObject::offsetGet(const Php::Value &key)
+{
+    // scope for the call
+    Scope scope(_core);
+
+    // get the array in a local variable
+    v8::Local<v8::Array> array(_object.Get(_core->isolate()).As<v8::Array>());
+
+    // get the element
+    v8::Local<v8::Value> element;
+    if (!array->Get(scope, this->key(key)).ToLocal(&element)) return nullptr;
+
+    // convert the value to a PHP value
+    return PhpVariable(_core->isolate(), element);
+}
+
+/**
+ *  Change an element
+ *  @param  key     The index (or null to append)
+ *  @param  value   The new value
+ */
+void PhpArrayObject::offsetSet(const Php::Value &key, const Php::Value &value)
+{
+    // scope for the call
+    Scope scope(_core);
+
+    // get the array in a local variable
+    v8::Local<v8::Array> array(_object.Get(_core->isolate()).As<v8::Array>());
+
+    // $array[] = $value appends to the end
+    if (key.isNull()) array->Set(scope, array->Length(), FromPhp(_core->isolate(), value)).Check();
+
+    // otherwise we set the element (we explicitly want to ignore the return-value)
+    else array->Set(scope, this->key(key), FromPhp(_core->isolate(), value)).Check();
+}
+
+/**
+ *  Remove an element
+ *  @param  key     The index
+ */
+void PhpArrayObject::offsetUnset(const Php::Value &key)
+{
+    // scope for the call
+    Scope scope(_core);
+
+    // get the array in a local variable
+    v8::Local<v8::Array> array(_object.Get(_core->isolate()).As<v8::Array>());
+
+    // remove the element (just like "delete" in javascript, this leaves a hole)
+    array->Delete(scope, this->key(key)).Check();
+}
+
+/**
+ *  Number of elements
+ *  @return long
+ */
+long PhpArrayObject::count()
+{
+    // scope for the call
+    Scope scope(_core);
+
+    // the length of the array
+    return _object.Get(_core->isolate()).As<v8::Array>()->Length();
+}
+
+/**
+ *  Retrieve the iterator
+ *  @return The iterator
+ */
+Php::Iterator *PhpArrayObject::getIterator()
+{
+    // scope for the call
+    Scope scope(_core);
+
+    // get the array in a local variable
+    v8::Local<v8::Object> object(_object.Get(_core->isolate()).As<v8::Object>());
+
+    // create a new iterator instance, cleaned up by PHP-CPP
+    return new PhpIterator(this, _core, object);
+}
+
+/**
+ *  Convert the entire array into a PHP array, including the nested arrays
+ *  @param  params      optional: number of levels that are converted into arrays
+ *  @return Php::Value
+ */
+Php::Value PhpArrayObject::toArray(Php::Parameters &params)
+{
+    // scope for the call
+    Scope scope(_core);
+
+    // catch any errors that occur while reading the elements
+    v8::TryCatch catcher(_core->isolate());
+
+    // the number of levels to convert
+    size_t depth = params.size() > 0 ? std::max<int64_t>(params[0].numericValue(), 1) : 512;
+
+    // convert all elements in one go (nested arrays are not exposed as JS\Array objects)
+    Php::Value result = PhpCopy(_core->isolate()).value(_object.Get(_core->isolate()), depth);
+
+    // no exception
+    if (!catcher.HasCaught()) return result;
+
+    // pass this exception on to PHP userspace
+    throw PhpException(_core->isolate(), catcher);
+}
+
+/**
+ *  End namespace
+ */
+}
@@ -0,0 +1,111 @@
+/**
+ *  PhpArrayObject.h
+ *
+ *  Class that wraps around an ecmascript array and makes it available to PHP
+ *  userspace as a JS\Array object. Unlike the regular conversion (which
+ *  copies all elements into a PHP array right away), the elements are only
+ *  read from the javascript array when they are accessed.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include "php_base.h"
+
+/**
+ *  Start namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class PhpArrayObject : public PhpBase, public Php::ArrayAccess, public Php::Countable, public Php::Traversable
+{
+private:
+    /**
+     *  Helper method to convert a PHP key to a javascript key
+     *  @param  key
+     *  @return v8::Local<v8::Value>
+     */
+    v8::Local<v8::Value> key(const Php::Value &key) const;
+
+public:
+    /**
+     *  Constructor
+     *  @param  isolate     The isolate
+     *  @param  array       The ecmascript array
+     */
+    PhpArrayObject(v8::Isolate *isolate, const v8::Local<v8::Array> &array) :
+        PhpBase(isolate, array) {}
+
+    /**
+     *  No copying
+     *  @param  that
+     */
+    PhpArrayObject(const PhpArrayObject &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~PhpArrayObject() = default;
+
+    /**
+     *  Check if an element exists
+     *  @param  key     The index
+     *  @return bool
+     */
+    virtual bool offsetExists(const Php::Value &key) override;
+
+    /**
+     *  Retrieve an element
+     *  @param  key     The index
+     *  @return Php::Value
+     */
+    virtual Php::Value offsetGet(const Php::Value &key) override;
+
+    /**
+     *  Change an element
+     *  @param  key     The index (or null to append)
+     *  @param  value   The new value
+     */
+    virtual void offsetSet(const Php::Value &key, const Php::Value &value) override;
+
+    /**
+     *  Remove an element
+     *  @param  key     The index
+     */
+    virtual void offsetUnset(const Php::Value &key) override;
+
+    /**
+     *  Number of elements
+     *  @return long
+     */
+    virtual long count() override;
+
+    /**
+     *  Retrieve the iterator
+     *  @return The iterator
+     */
+    virtual Php::Iterator *getIterator() override;
+
+    /**
+     *  Convert the entire array into a PHP array, including the nested arrays
+     *  @param  params      optional: number of levels that are converted into arrays
+     *  @return Php::Value
+     */
+    Php::Value toArray(Php::Parameters &params);
+};
+
+/**
+ *  End namespace
+ */
+}
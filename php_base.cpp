@@ -26,12 +26,28 @@ namespace JS {
  */
 PhpBase::PhpBase(v8::Isolate *isolate, const v8::Local<v8::Value> &object) :
     _core(Core::upgrade(isolate)),
-    _object(isolate, object) {}
+    _object(isolate, object)
+{
+    // register with the core, so that we can be made inert when the context is disposed
+    _core->add(this);
+}
 
 /**
  *  Destructor
  */
 PhpBase::~PhpBase()
+{
+    // forget the associated javascript object
+    _object.Reset();
+
+    // unregister from the core
+    _core->remove(this);
+}
+
+/**
+ *  Forget the javascript value, because the context was disposed
+ */
+void PhpBase::detach()
 {
     // forget the associated javascript object
     _object.Reset();
@@ -45,7 +61,7 @@ PhpBase::~PhpBase()
 PhpBase *PhpBase::unwrap(const Php::Value &value)
 {
     // must be the right class
-    if (!value.instanceOf(Names::Object) && !value.instanceOf(Names::Function)) return nullptr;
+    if (!value.instanceOf(Names::Object) && !value.instanceOf(Names::Function) && !value.instanceOf(Names::Array) && !value.instanceOf(Names::Iterator)) return nullptr;
 
     // get self-pointer
     return (PhpBase *)value.implementation();
@@ -57,6 +73,9 @@ PhpBase *PhpBase::unwrap(const Php::Value &value)
  */
 v8::Local<v8::Value> PhpBase::handle()
 {
+    // the object can no longer be used when the context was disposed
+    if (_object.IsEmpty()) throw Php::Exception("Context has been disposed");
+
     // get the local handle back
     return _object.Get(_core->isolate());
 }
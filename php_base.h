@@ -68,6 +68,11 @@ public:
      */
     virtual ~PhpBase();
     
+    /**
+     *  Forget the javascript value, because the context was disposed
+     */
+    virtual void detach();
+
     /**
      *  Helper method to unwrap an object
      *  @param  value
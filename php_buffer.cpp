@@ -0,0 +1,77 @@
+/**
+ *  PhpBuffer.cpp
+ *
+ *  Implementation file for the PhpBuffer class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "php_buffer.h"
+#include "zendvalue.h"
+#include "allocator.h"
+#include "names.h"
+#include <cstring>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Helper method to unwrap an object
+ *  @param  value
+ *  @return PhpBuffer
+ */
+PhpBuffer *PhpBuffer::unwrap(const Php::Value &value)
+{
+    // must be the right class
+    if (!value.instanceOf(Names::Buffer)) return nullptr;
+
+    // get self-pointer
+    return (PhpBuffer *)value.implementation();
+}
+
+/**
+ *  PHP constructor
+ *  @param  params
+ */
+void PhpBuffer::__construct(Php::Parameters &params)
+{
+    // the data is optional
+    if (params.empty()) return;
+
+    // store the data as string
+    _data = params[0].isString() ? params[0] : params[0].clone(Php::Type::String);
+}
+
+/**
+ *  Create a javascript Uint8Array with the data
+ *  @param  isolate
+ *  @return v8::Local<v8::Value>
+ */
+v8::Local<v8::Value> PhpBuffer::handle(v8::Isolate *isolate) const
+{
+    // the data (this is null when the buffer was constructed without data)
+    zval *data = ZendValue::get(_data);
+
+    // number of bytes
+    size_t size = Z_TYPE_P(data) == IS_STRING ? Z_STRLEN_P(data) : 0;
+
+    // create the buffer (the memory must be allocated inside the v8 sandbox, so we cannot share it with PHP)
+    auto buffer = Allocator::buffer(isolate, size);
+
+    // copy the data
+    if (size > 0) memcpy(buffer->Data(), Z_STRVAL_P(data), size);
+
+    // expose it as array of bytes
+    return v8::Uint8Array::New(buffer, 0, size);
+}
+
+/**
+ *  End of namespace
+ */
+}
@@ -0,0 +1,93 @@
+/**
+ *  PhpBuffer.h
+ *
+ *  Class that is exposed to PHP space as JS\Buffer. PHP strings are passed
+ *  to javascript as (utf-8 decoded) strings, so binary data has to be
+ *  wrapped in a JS\Buffer to be passed as Uint8Array instead.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class PhpBuffer : public Php::Base, public Php::Countable
+{
+private:
+    /**
+     *  The binary data
+     *  @var Php::Value
+     */
+    Php::Value _data;
+
+public:
+    /**
+     *  Constructor
+     */
+    PhpBuffer() = default;
+
+    /**
+     *  No copying
+     *  @param  that
+     */
+    PhpBuffer(const PhpBuffer &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~PhpBuffer() = default;
+
+    /**
+     *  Helper method to unwrap an object
+     *  @param  value
+     *  @return PhpBuffer
+     */
+    static PhpBuffer *unwrap(const Php::Value &value);
+
+    /**
+     *  Create a javascript Uint8Array with the data
+     *  @param  isolate
+     *  @return v8::Local<v8::Value>
+     */
+    v8::Local<v8::Value> handle(v8::Isolate *isolate) const;
+
+    /**
+     *  PHP constructor
+     *  @param  params
+     */
+    void __construct(Php::Parameters &params);
+
+    /**
+     *  The binary data
+     *  @return Php::Value
+     */
+    Php::Value __toString() { return _data; }
+
+    /**
+     *  Number of bytes
+     *  @return long
+     */
+    virtual long count() override { return _data.size(); }
+};
+
+/**
+ *  End of namespace
+ */
+}
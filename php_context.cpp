@@ -38,6 +38,7 @@ void PhpContext::__construct(Php::Parameters &params)
  *                  -   string  name of property to assign  required
  *                  -   mixed   property value to assign    required
  *                  -   integer property attributes         optional
+ *                  -   integer conversion mode             optional
  *
  *  The property attributes can be one of the following values
  *
@@ -46,28 +47,124 @@ void PhpContext::__construct(Php::Parameters &params)
  *  - DontDelete
  *
  *  If not specified, the property will be writable, enumerable and
- *  deletable.
+ *  deletable. The conversion mode (JS\Proxy, JS\Copy or JS\Auto)
+ *  overrides the conversion policy of the context for this value.
  */
 Php::Value PhpContext::assign(Php::Parameters &params)
 {
     // pass on
-    _core->assign(params[0], params[1], params.size() > 2 ? params[2] : Php::Value(v8::None));
+    _core->assign(params[0], params[1], params.size() > 2 ? params[2] : Php::Value(v8::None), params.size() > 3 ? params[3] : Php::Value(nullptr));
     
     // allow chaining
     return this;
 }
 
+/**
+ *  Assign a PHP callable to the javascript context as a real function
+ *  @param  params  array of parameters:
+ *                  -   string   name of the function          required
+ *                  -   callable the function to assign        required
+ *                  -   array    types of the parameters       optional
+ *
+ *  The supported parameter types are "int", "float", "string", "bool"
+ *  and "mixed". If no types are specified, they are derived from the
+ *  declaration of the callable.
+ */
+Php::Value PhpContext::assignFunction(Php::Parameters &params)
+{
+    // pass on
+    _core->assignFunction(params[0], params[1], params.size() > 2 ? params[2] : Php::Value(nullptr));
+
+    // allow chaining
+    return this;
+}
+
+/**
+ *  Assign a list of numbers to the javascript context as a typed array
+ *  @param  params  array of parameters:
+ *                  -   string   name of the property           required
+ *                  -   array    the numbers                    required
+ *                  -   integer  JS\Float64 or JS\Int32          optional
+ *  @return Php::Value
+ *  @throws Php::Exception
+ */
+Php::Value PhpContext::assignNumeric(Php::Parameters &params)
+{
+    // pass on
+    _core->assignNumeric(params[0], params[1], params.size() > 2 ? params[2] : Php::Value(nullptr));
+
+    // allow chaining
+    return this;
+}
+
+/**
+ *  Assign a JSON document to the javascript context
+ *  @param  params  array of parameters:
+ *                  -   string   name of the property           required
+ *                  -   string   the JSON document              required
+ *  @return Php::Value
+ *  @throws Php::Exception
+ */
+Php::Value PhpContext::assignJson(Php::Parameters &params)
+{
+    // pass on
+    _core->assignJson(params[0], params[1]);
+
+    // allow chaining
+    return this;
+}
+
+/**
+ *  Change the policy for converting PHP arrays and objects into javascript
+ *  @param  params  array of parameters:
+ *                  -   integer mode (JS\Proxy, JS\Copy or JS\Auto)        required
+ *                  -   integer max number of elements to copy          optional
+ *                  -   integer max depth to copy                       optional
+ *  @return Php::Value
+ *  @throws Php::Exception
+ */
+Php::Value PhpContext::setConversion(Php::Parameters &params)
+{
+    // construct the policy and pass it on
+    _core->conversion(Conversion(params[0], params.size() > 1 ? params[1] : Php::Value(nullptr), params.size() > 2 ? params[2] : Php::Value(nullptr)));
+
+    // allow chaining
+    return this;
+}
+
+/**
+ *  Statistics about the context
+ *  @return Php::Value
+ */
+Php::Value PhpContext::statistics()
+{
+    // pass on
+    return _core->statistics();
+}
+
+/**
+ *  Release the context and everything that is linked to it right away
+ */
+void PhpContext::dispose()
+{
+    // pass on
+    _core->dispose();
+}
+
 /**
  *  Parse a piece of javascript code
  *
- *  @param  params  array with one parameter: the code to execute
+ *  @param  params  array of parameters:
+ *                  -   string  the code to execute        required
+ *                  -   float   timeout in seconds         optional
+ *                  -   integer flags (like JS\AsRows)     optional
  *  @return Php::Value
  *  @throws Php::Exception
  */
 Php::Value PhpContext::evaluate(Php::Parameters &params)
 {
     // pass on
-    return _core->evaluate(params[0], params.size() > 1 ? params[1] : Php::Value(0));
+    return _core->evaluate(params[0], params.size() > 1 ? params[1] : Php::Value(0), params.size() > 2 ? params[2] : Php::Value(0));
 }
 
 /**
@@ -64,6 +64,7 @@ public:
      *                  -   string  name of property to assign  required
      *                  -   mixed   property value to assign    required
      *                  -   integer property attributes         optional
+     *                  -   integer conversion mode             optional
      *
      *  The property attributes can be one of the following values
      *
@@ -72,15 +73,101 @@ public:
      *  - DontDelete
      *
      *  If not specified, the property will be writable, enumerable and
-     *  deletable.
+     *  deletable. The conversion mode (JS\Proxy, JS\Copy or JS\Auto)
+     *  overrides the conversion policy of the context for this value.
      * 
      *  @return Php::Value
      */
     Php::Value assign(Php::Parameters &params);
 
+    /**
+     *  Assign a PHP callable to the javascript context as a real function
+     *
+     *  @param  params  array of parameters:
+     *                  -   string   name of the function          required
+     *                  -   callable the function to assign        required
+     *                  -   array    types of the parameters       optional
+     *
+     *  The supported parameter types are "int", "float", "string", "bool"
+     *  and "mixed". If no types are specified, they are derived from the
+     *  declaration of the callable.
+     *
+     *  @return Php::Value
+     */
+    Php::Value assignFunction(Php::Parameters &params);
+
+    /**
+     *  Assign a list of numbers to the javascript context as a typed array
+     *
+     *  @param  params  array of parameters:
+     *                  -   string   name of the property           required
+     *                  -   array    the numbers                    required
+     *                  -   integer  JS\Float64 or JS\Int32          optional
+     *
+     *  The values are copied in one pass into a Float64Array (the default)
+     *  or an Int32Array, the keys of the array are ignored.
+     *
+     *  @return Php::Value
+     *  @throws Php::Exception
+     */
+    Php::Value assignNumeric(Php::Parameters &params);
+
+    /**
+     *  Assign a JSON document to the javascript context
+     *
+     *  @param  params  array of parameters:
+     *                  -   string   name of the property           required
+     *                  -   string   the JSON document              required
+     *
+     *  The document is parsed by v8 into native javascript values, which
+     *  is much faster than passing the decoded document as PHP array.
+     *
+     *  @return Php::Value
+     *  @throws Php::Exception
+     */
+    Php::Value assignJson(Php::Parameters &params);
+
+    /**
+     *  Change the policy for converting PHP arrays and objects into javascript
+     *
+     *  @param  params  array of parameters:
+     *                  -   integer mode                        required
+     *                  -   integer max number of elements      optional
+     *                  -   integer max depth                   optional
+     *
+     *  With JS\Proxy (the default) arrays and objects are wrapped in a proxy,
+     *  with JS\Copy arrays and JsonSerializable objects are copied into native
+     *  javascript values, and with JS\Auto they are only copied when they do not
+     *  exceed the max number of elements and the max depth.
+     *
+     *  @return Php::Value
+     *  @throws Php::Exception
+     */
+    Php::Value setConversion(Php::Parameters &params);
+
+    /**
+     *  Statistics about the context
+     *  @return Php::Value
+     */
+    Php::Value statistics();
+
+    /**
+     *  Release the context and everything that is linked to it right away
+     */
+    void dispose();
+
     /**
      *  Parse a piece of javascript code
-     *  @param  params  array with one parameter: the code to execute
+     *
+     *  @param  params  array of parameters:
+     *                  -   string  the code to execute        required
+     *                  -   float   timeout in seconds         optional
+     *                  -   integer flags                      optional
+     *
+     *  With the JS\AsRows flag, an array of objects that all have the same
+     *  properties is converted into an array of PHP arrays. With the JS\AsJson
+     *  flag, the result is returned as JSON string.
+     *
      *  @return Php::Value
      *  @throws Php::Exception
      */
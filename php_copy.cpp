@@ -0,0 +1,206 @@
+/**
+ *  PhpCopy.cpp
+ *
+ *  Implementation file for the PhpCopy class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "php_copy.h"
+#include "php_variable.h"
+#include "linker.h"
+#include "php_base.h"
+#include "interned.h"
+#include "zendvalue.h"
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Should an object be converted into a PHP array?
+ *  @param  object
+ *  @return bool
+ */
+bool PhpCopy::copyable(const v8::Local<v8::Object> &object)
+{
+    // arrays can always be converted
+    if (object->IsArray()) return true;
+
+    // objects with special behavior are not just a collection of properties
+    if (object->IsFunction() || object->IsDate() || object->IsRegExp() || object->IsPromise() || object->IsProxy()) return false;
+
+    // the same goes for the collections and the wrapped scalars
+    if (object->IsMap() || object->IsSet() || object->IsStringObject() || object->IsNumberObject() || object->IsBooleanObject()) return false;
+
+    // plain object
+    return true;
+}
+
+/**
+ *  Convert a value
+ *  @param  value       the value to convert
+ *  @param  depth       number of levels that may be converted into PHP arrays
+ *  @return Php::Value
+ */
+Php::Value PhpCopy::value(const v8::Local<v8::Value> &value, size_t depth)
+{
+    // scalars and values that are nested too deep are converted the regular way
+    if (depth == 0 || !value->IsObject()) return PhpVariable(_isolate, value);
+
+    // we need the object
+    auto object = value.As<v8::Object>();
+
+    // objects that cannot be converted into arrays are converted the regular way too
+    if (!copyable(object)) return PhpVariable(_isolate, value);
+
+    // objects that wrap a PHP value (and not a JS\Object that was created for the object itself) are exposed as that value
+    Linker linker(_isolate, object);
+    if (linker.valid() && PhpBase::unwrap(linker.value()) == nullptr) return linker.value();
+
+    // if the object is one of its own parents we have a cycle
+    for (const auto &parent : _path) if (parent == object) return PhpVariable(_isolate, value);
+
+    // the identity hash is stable for as long as the object lives
+    int hash = object->GetIdentityHash();
+
+    // if the object was already converted, we can share the result
+    auto range = _converted.equal_range(hash);
+    for (auto iter = range.first; iter != range.second; ++iter) if (iter->second.first == object) return iter->second.second;
+
+    // the object is now being converted
+    _path.push_back(object);
+
+    // convert it
+    Php::Value result = object->IsArray() ? array(object.As<v8::Array>(), depth) : this->object(object, depth);
+
+    // the object is done
+    _path.pop_back();
+
+    // remember the result
+    _converted.emplace(hash, std::make_pair(object, result));
+
+    // expose the result
+    return result;
+}
+
+/**
+ *  Convert a javascript array
+ *  @param  array       the array to convert
+ *  @param  depth       number of levels that may still be converted
+ *  @return Php::Value
+ */
+Php::Value PhpCopy::array(const v8::Local<v8::Array> &array, size_t depth)
+{
+    // the number of elements
+    uint32_t length = array->Length();
+
+    // create an array of the right size
+    Php::Value result = ZendValue::array(length);
+
+    // the underlying hashtable
+    HashTable *table = Z_ARRVAL_P(ZendValue::get(result));
+
+    // iterate over the input array
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        // get the element (stop if an exception was thrown)
+        v8::Local<v8::Value> element;
+        if (!array->Get(_context, i).ToLocal(&element)) break;
+
+        // arrays can be sparse
+        if (element->IsUndefined()) continue;
+
+        // convert the element and add it
+        ZendValue::add(table, i, value(element, depth - 1));
+    }
+
+    // expose the result
+    return result;
+}
+
+/**
+ *  Convert a javascript object
+ *  @param  object      the object to convert
+ *  @param  depth       number of levels that may still be converted
+ *  @return Php::Value
+ */
+Php::Value PhpCopy::object(const v8::Local<v8::Object> &object, size_t depth)
+{
+    // the enumerable own properties (indices are kept as numbers)
+    v8::Local<v8::Array> names;
+    if (!object->GetOwnPropertyNames(_context, static_cast<v8::PropertyFilter>(v8::ONLY_ENUMERABLE | v8::SKIP_SYMBOLS), v8::KeyConversionMode::kKeepNumbers).ToLocal(&names)) return nullptr;
+
+    // the number of properties
+    uint32_t length = names->Length();
+
+    // create an array of the right size
+    Php::Value result = ZendValue::array(length);
+
+    // the underlying hashtable
+    HashTable *table = Z_ARRVAL_P(ZendValue::get(result));
+
+    // iterate over the properties
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        // get the name and the value (stop if an exception was thrown)
+        v8::Local<v8::Value> name, element;
+        if (!names->Get(_context, i).ToLocal(&name)) break;
+        if (!object->Get(_context, name).ToLocal(&element)) break;
+
+        // convert the element
+        Php::Value converted = value(element, depth - 1);
+
+        // indices are added as numeric keys
+        if (name->IsUint32()) ZendValue::add(table, name.As<v8::Uint32>()->Value(), converted);
+
+        // property names are often the same, so we use the interned strings
+        else if (name->IsString()) ZendValue::add(table, Interned::php(_isolate, name.As<v8::String>()), converted);
+    }
+
+    // expose the result
+    return result;
+}
+
+/**
+ *  Convert a selection of the properties of an object
+ *  @param  object      the object
+ *  @param  names       the names of the properties
+ *  @param  depth       number of levels that may be converted into PHP arrays
+ *  @return Php::Value
+ */
+Php::Value PhpCopy::pluck(const v8::Local<v8::Object> &object, const Php::Value &names, size_t depth)
+{
+    // create an array of the right size
+    Php::Value result = ZendValue::array(names.size());
+
+    // the underlying hashtable
+    HashTable *table = Z_ARRVAL_P(ZendValue::get(result));
+
+    // iterate over the names
+    for (const auto &iter : names)
+    {
+        // the name must be a string
+        Php::Value name = iter.second.isString() ? iter.second : iter.second.clone(Php::Type::String);
+
+        // get the property (stop if an exception was thrown)
+        v8::Local<v8::Value> element;
+        if (!object->Get(_context, Interned::js(_isolate, name)).ToLocal(&element)) break;
+
+        // convert and add it
+        ZendValue::add(table, name, value(element, depth));
+    }
+
+    // expose the result
+    return result;
+}
+
+/**
+ *  End of namespace
+ */
+}
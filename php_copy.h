@@ -0,0 +1,125 @@
+/**
+ *  PhpCopy.h
+ *
+ *  Class to convert a javascript object into a PHP array in one go. All
+ *  properties are read within the same scope, and the PHP hashtables are
+ *  allocated at their final size. Objects that are referred to more than
+ *  once are only converted once (PHP arrays are copy-on-write, so they can
+ *  be shared), and objects that refer back to themselves, or that are
+ *  nested too deeply, are exposed as regular JS\Object proxies.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+#include <unordered_map>
+#include <vector>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class PhpCopy
+{
+private:
+    /**
+     *  The isolate
+     *  @var v8::Isolate
+     */
+    v8::Isolate *_isolate;
+
+    /**
+     *  The current context
+     *  @var v8::Local<v8::Context>
+     */
+    v8::Local<v8::Context> _context;
+
+    /**
+     *  The objects that were already converted, indexed by their identity hash
+     *  @var std::unordered_multimap
+     */
+    std::unordered_multimap<int, std::pair<v8::Local<v8::Object>, Php::Value>> _converted;
+
+    /**
+     *  The objects that are being converted right now (to detect cycles)
+     *  @var std::vector
+     */
+    std::vector<v8::Local<v8::Object>> _path;
+
+    /**
+     *  Convert a javascript array
+     *  @param  array       the array to convert
+     *  @param  depth       number of levels that may still be converted
+     *  @return Php::Value
+     */
+    Php::Value array(const v8::Local<v8::Array> &array, size_t depth);
+
+    /**
+     *  Convert a javascript object
+     *  @param  object      the object to convert
+     *  @param  depth       number of levels that may still be converted
+     *  @return Php::Value
+     */
+    Php::Value object(const v8::Local<v8::Object> &object, size_t depth);
+
+public:
+    /**
+     *  Should an object be converted into a PHP array?
+     *  @param  object
+     *  @return bool
+     */
+    static bool copyable(const v8::Local<v8::Object> &object);
+
+    /**
+     *  Constructor
+     *  @param  isolate     the isolate (there must be a scope)
+     */
+    PhpCopy(v8::Isolate *isolate) : _isolate(isolate), _context(isolate->GetCurrentContext()) {}
+
+    /**
+     *  No copying
+     *  @param  that
+     */
+    PhpCopy(const PhpCopy &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~PhpCopy() = default;
+
+    /**
+     *  Convert a value
+     *  @param  value       the value to convert
+     *  @param  depth       number of levels that may be converted into PHP arrays
+     *  @return Php::Value
+     */
+    Php::Value value(const v8::Local<v8::Value> &value, size_t depth);
+
+    /**
+     *  Convert a selection of the properties of an object
+     *  @param  object      the object
+     *  @param  names       the names of the properties
+     *  @param  depth       number of levels that may be converted into PHP arrays
+     *  @return Php::Value
+     */
+    Php::Value pluck(const v8::Local<v8::Object> &object, const Php::Value &names, size_t depth);
+};
+
+/**
+ *  End of namespace
+ */
+}
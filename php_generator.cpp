@@ -0,0 +1,269 @@
+/**
+ *  PhpGenerator.cpp
+ *
+ *  Implementation file for the PhpGenerator class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "php_generator.h"
+#include "php_variable.h"
+#include "php_exception.h"
+#include "scope.h"
+#include "core.h"
+
+/**
+ *  Start namespace
+ */
+namespace JS {
+
+/**
+ *  The iterator that is handed out to PHP-CPP, it passes all calls on to the
+ *  generator (which holds the state, because it can only be iterated once)
+ */
+class GeneratorIterator : public Php::Iterator
+{
+private:
+    /**
+     *  The generator
+     *  @var PhpGenerator
+     */
+    PhpGenerator *_generator;
+
+public:
+    /**
+     *  Constructor
+     *  @param  generator   The generator to iterate
+     */
+    GeneratorIterator(PhpGenerator *generator) : Php::Iterator(generator), _generator(generator) {}
+
+    /**
+     *  Destructor
+     */
+    virtual ~GeneratorIterator() = default;
+
+    /**
+     *  Is the iterator still valid?
+     *  @return bool
+     */
+    virtual bool valid() override { return _generator->valid(); }
+
+    /**
+     *  Retrieve the current value
+     *  @return Php::Value
+     */
+    virtual Php::Value current() override { return _generator->current(); }
+
+    /**
+     *  Retrieve the current key
+     *  @return Php::Value
+     */
+    virtual Php::Value key() override { return _generator->key(); }
+
+    /**
+     *  Move ahead to the next item
+     */
+    virtual void next() override { _generator->next(); }
+
+    /**
+     *  Start over at the beginning (not possible, so we simply continue where we were)
+     */
+    virtual void rewind() override {}
+};
+
+/**
+ *  Destructor
+ */
+PhpGenerator::~PhpGenerator()
+{
+    // if the iterator was abandoned halfway, we give it the chance to clean up (this
+    // runs the "finally" blocks of a generator, just like a break in a for-of loop)
+    if (_fetched > 0 && !_done && !_core->disposed())
+    {
+        // scope for the call
+        Scope scope(_core);
+
+        // the isolate is needed a couple of times
+        auto *isolate = _core->isolate();
+
+        // errors thrown by the iterator cannot be reported from a destructor
+        v8::TryCatch catcher(isolate);
+
+        // get the object in a local variable
+        v8::Local<v8::Object> object(_object.Get(isolate).As<v8::Object>());
+
+        // look up the return() method, which is optional
+        v8::Local<v8::Value> method;
+        if (object->Get(scope, v8::String::NewFromUtf8Literal(isolate, "return", v8::NewStringType::kInternalized)).ToLocal(&method) && method->IsFunction())
+        {
+            // call it (we are not interested in the result)
+            method.As<v8::Function>()->Call(scope, object, 0, nullptr).IsEmpty();
+        }
+    }
+
+    // destruct the handle
+    _next.Reset();
+}
+
+/**
+ *  Forget the javascript value, because the context was disposed
+ */
+void PhpGenerator::detach()
+{
+    // forget the handles
+    PhpBase::detach();
+    _next.Reset();
+
+    // the iterator can no longer be used
+    _done = true;
+}
+
+/**
+ *  Check if a javascript object is a builtin iterator (a generator, or the iterator of
+ *  an array, string, map or set), and return its next() method. Other objects with a
+ *  next() method are regular JS\Object instances, because for them next() could mean
+ *  something else, and they may have other properties that PHP wants to use.
+ *  @param  isolate     The isolate
+ *  @param  object      The object to check
+ *  @return v8::Local<v8::Function>     empty if the object is not an iterator
+ */
+v8::Local<v8::Function> PhpGenerator::next(v8::Isolate *isolate, const v8::Local<v8::Object> &object)
+{
+    // the current context
+    auto context = isolate->GetCurrentContext();
+
+    // getters could throw, in which case the object is simply not treated as an iterator
+    v8::TryCatch catcher(isolate);
+
+    // proxies are never accepted (checking them could run traps)
+    if (object->IsProxy()) return v8::Local<v8::Function>();
+
+    // only the builtin iterators are accepted, the iterators of arrays and strings are recognized by their prototype
+    if (!object->IsGeneratorObject() && !object->IsMapIterator() && !object->IsSetIterator() && !Core::upgrade(isolate)->iterator(object->GetPrototypeV2())) return v8::Local<v8::Function>();
+
+    // get the next() method
+    v8::Local<v8::Value> next;
+    if (!object->Get(context, v8::String::NewFromUtf8Literal(isolate, "next", v8::NewStringType::kInternalized)).ToLocal(&next) || !next->IsFunction()) return v8::Local<v8::Function>();
+
+    // this is an iterator
+    return next.As<v8::Function>();
+}
+
+/**
+ *  Fetch the next value from the iterator
+ */
+void PhpGenerator::fetch()
+{
+    // scope for the call
+    Scope scope(_core);
+
+    // the isolate is needed a couple of times
+    auto *isolate = _core->isolate();
+
+    // catch errors that are thrown by the iterator
+    v8::TryCatch catcher(isolate);
+
+    // get the object in a local variable
+    v8::Local<v8::Object> object(_object.Get(isolate).As<v8::Object>());
+
+    // if anything goes wrong, the iterator is finished
+    _done = true;
+
+    // call the next() method
+    v8::Local<v8::Value> result;
+    if (!_next.Get(isolate)->Call(scope, object, 0, nullptr).ToLocal(&result))
+    {
+        // report the error
+        if (catcher.HasCaught()) throw PhpException(isolate, catcher);
+
+        // the script was terminated
+        return;
+    }
+
+    // the result should be an object
+    if (!result->IsObject()) throw Php::Exception("Iterator result is not an object");
+
+    // get the result in a local variable
+    auto record = result.As<v8::Object>();
+
+    // read the properties of the record
+    v8::Local<v8::Value> done, value;
+    if (!record->Get(scope, v8::String::NewFromUtf8Literal(isolate, "done", v8::NewStringType::kInternalized)).ToLocal(&done)) throw PhpException(isolate, catcher);
+    if (!record->Get(scope, v8::String::NewFromUtf8Literal(isolate, "value", v8::NewStringType::kInternalized)).ToLocal(&value)) throw PhpException(isolate, catcher);
+
+    // are we finished? (the value that is returned by the generator is not part of the sequence)
+    if (done->BooleanValue(isolate)) { _current = nullptr; return; }
+
+    // convert the value
+    _current = PhpVariable(isolate, value);
+
+    // we have a current element
+    _done = false;
+    _ready = true;
+    _fetched += 1;
+}
+
+/**
+ *  Is there a current element?
+ *  @return bool
+ */
+bool PhpGenerator::valid()
+{
+    // fetch the element on demand
+    if (!_ready && !_done) fetch();
+
+    // the element is valid if the iterator did not yet finish
+    return !_done;
+}
+
+/**
+ *  The current element
+ *  @return Php::Value
+ */
+Php::Value PhpGenerator::current()
+{
+    // fetch the element (if this did not yet happen)
+    return valid() ? _current : nullptr;
+}
+
+/**
+ *  The key of the current element
+ *  @return Php::Value
+ */
+Php::Value PhpGenerator::key()
+{
+    // the elements are numbered, just like the elements of a PHP generator without keys
+    return valid() ? Php::Value(_fetched - 1) : nullptr;
+}
+
+/**
+ *  Move on to the next element
+ */
+void PhpGenerator::next()
+{
+    // if the current element was never fetched, it is skipped
+    if (!_ready && !_done) fetch();
+
+    // the next element will be fetched on demand
+    _ready = false;
+    _current = nullptr;
+}
+
+/**
+ *  Retrieve the iterator
+ *  @return The iterator
+ */
+Php::Iterator *PhpGenerator::getIterator()
+{
+    // create a new iterator instance, cleaned up by PHP-CPP
+    return new GeneratorIterator(this);
+}
+
+/**
+ *  End namespace
+ */
+}
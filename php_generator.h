@@ -0,0 +1,139 @@
+/**
+ *  PhpGenerator.h
+ *
+ *  Class that wraps around an ecmascript iterator (like a generator) and
+ *  makes it available to PHP userspace as a JS\Iterator object. Iterating
+ *  over it with foreach calls the next() method of the javascript iterator
+ *  one element at a time, so that very large results can be streamed into
+ *  PHP without building a javascript array first.
+ *
+ *  Just like a PHP generator, the object can only be iterated once.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include "php_base.h"
+
+/**
+ *  Start namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class PhpGenerator : public PhpBase, public Php::Traversable
+{
+private:
+    /**
+     *  The next() method of the iterator
+     *  @var v8::Global<v8::Function>
+     */
+    v8::Global<v8::Function> _next;
+
+    /**
+     *  The current value
+     *  @var Php::Value
+     */
+    Php::Value _current;
+
+    /**
+     *  Number of elements that were fetched (the key of the current value is one less)
+     *  @var int64_t
+     */
+    int64_t _fetched = 0;
+
+    /**
+     *  Has the current value already been fetched?
+     *  @var bool
+     */
+    bool _ready = false;
+
+    /**
+     *  Has the iterator finished?
+     *  @var bool
+     */
+    bool _done = false;
+
+    /**
+     *  Fetch the next value from the iterator
+     */
+    void fetch();
+
+public:
+    /**
+     *  Constructor
+     *  @param  isolate     The isolate
+     *  @param  object      The ecmascript iterator
+     *  @param  next        Its next() method
+     */
+    PhpGenerator(v8::Isolate *isolate, const v8::Local<v8::Object> &object, const v8::Local<v8::Function> &next) :
+        PhpBase(isolate, object), _next(isolate, next) {}
+
+    /**
+     *  No copying
+     *  @param  that
+     */
+    PhpGenerator(const PhpGenerator &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~PhpGenerator();
+
+    /**
+     *  Forget the javascript value, because the context was disposed
+     */
+    virtual void detach() override;
+
+    /**
+     *  Check if a javascript object is a builtin iterator, and return its next() method
+     *  @param  isolate     The isolate
+     *  @param  object      The object to check
+     *  @return v8::Local<v8::Function>     empty if the object is not an iterator
+     */
+    static v8::Local<v8::Function> next(v8::Isolate *isolate, const v8::Local<v8::Object> &object);
+
+    /**
+     *  Is there a current element?
+     *  @return bool
+     */
+    bool valid();
+
+    /**
+     *  The current element
+     *  @return Php::Value
+     */
+    Php::Value current();
+
+    /**
+     *  The key of the current element
+     *  @return Php::Value
+     */
+    Php::Value key();
+
+    /**
+     *  Move on to the next element
+     */
+    void next();
+
+    /**
+     *  Retrieve the iterator
+     *  @return The iterator
+     */
+    virtual Php::Iterator *getIterator() override;
+};
+
+/**
+ *  End namespace
+ */
+}
@@ -13,12 +13,19 @@
 #include "php_iterator.h"
 #include "scope.h"
 #include "php_variable.h"
+#include "interned.h"
 
 /**
  *  Begin of namespace
  */
 namespace JS {
 
+/**
+ *  Number of elements that are fetched and converted in one go
+ *  @var size_t
+ */
+static constexpr size_t chunk = 64;
+
 /**
  *  Constructor
  *  @param  base        The base that PHP-CPP insists on
@@ -31,9 +38,13 @@ PhpIterator::PhpIterator(Php::Base *base, const std::shared_ptr<Core> &core, con
 {
     // get a scope (we already have one when we are called, but ok)
     Scope scope(core);
+
+    // the indices of arrays are kept as numbers, so that they do not have to be converted into
+    // strings (holes in sparse arrays are skipped, and other properties are included as well)
+    auto conversion = object->IsArray() ? v8::KeyConversionMode::kKeepNumbers : v8::KeyConversionMode::kConvertToString;
     
     // get the key (this is a maybe)
-    auto maybe = object->GetPropertyNames(scope);
+    auto maybe = object->GetPropertyNames(scope, v8::KeyCollectionMode::kIncludePrototypes, static_cast<v8::PropertyFilter>(v8::ONLY_ENUMERABLE | v8::SKIP_SYMBOLS), v8::IndexFilter::kIncludeIndices, conversion);
     if (maybe.IsEmpty()) return;
     
     // convert to a v8::Local
@@ -56,14 +67,75 @@ PhpIterator::~PhpIterator()
     _keys.Reset();
 }
 
+/**
+ *  Fetch and convert the next chunk of elements
+ */
+void PhpIterator::fetch()
+{
+    // forget the previous chunk
+    _prefetchedKeys.clear();
+    _prefetchedValues.clear();
+    _position = 0;
+
+    // is there anything left?
+    if (_cursor >= _size) return;
+
+    // one scope for the entire chunk
+    Scope scope(_core);
+
+    // the isolate is needed a couple of times
+    auto *isolate = _core->isolate();
+
+    // get the object and keys in a local variables
+    v8::Local<v8::Object> object(_object.Get(isolate));
+    v8::Local<v8::Array> keys(_keys.Get(isolate));
+
+    // fetch elements until the chunk is full
+    while (_cursor < _size && _prefetchedValues.size() < chunk)
+    {
+        // the position of this element
+        uint32_t index = _cursor++;
+
+        // retrieve the key
+        v8::Local<v8::Value> key, value;
+        if (!keys->Get(scope, index).ToLocal(&key)) break;
+
+        // the indices of arrays are numbers, they are used as they are
+        if (key->IsUint32())
+        {
+            // retrieve the element by index
+            uint32_t position = key.As<v8::Uint32>()->Value();
+            if (!object->Get(scope, position).ToLocal(&value)) break;
+
+            // store the key
+            _prefetchedKeys.emplace_back(static_cast<int64_t>(position));
+        }
+        else
+        {
+            // retrieve the value
+            if (!object->Get(scope, key).ToLocal(&value)) break;
+
+            // property names are mostly strings, which are looked up in the cache of interned strings
+            if (key->IsString()) _prefetchedKeys.emplace_back(Interned::php(isolate, key.As<v8::String>()));
+            else _prefetchedKeys.emplace_back(PhpVariable(isolate, key));
+        }
+
+        // store the converted value
+        _prefetchedValues.emplace_back(PhpVariable(isolate, value));
+    }
+}
+
 /**
  *  Is the iterator still valid?
  *  @return is an element present at the current offset
  */
 bool PhpIterator::valid()
 {
+    // fetch the next chunk when the current one is used up
+    if (_position >= _prefetchedValues.size()) fetch();
+
     // we should not be out of bounds
-    return _position < _size;
+    return _position < _prefetchedValues.size();
 }
 
 /**
@@ -72,23 +144,8 @@ bool PhpIterator::valid()
  */
 Php::Value PhpIterator::current()
 {
-    // make sure there is a scope
-    Scope scope(_core);
-    
-    // get the object and keys in a local variables
-    v8::Local<v8::Object> object(_object.Get(_core->isolate()));
-    v8::Local<v8::Array> keys(_keys.Get(_core->isolate()));
-    
-    // retrieve the current key
-    auto key = keys->Get(scope, _position);
-    if (key.IsEmpty()) return nullptr;
-    
-    // retrieve the current key, the value and convert it
-    auto value = object->Get(scope, key.ToLocalChecked());
-    if (key.IsEmpty()) return nullptr;
-    
-    // expose to php space
-    return PhpVariable(_core->isolate(), value.ToLocalChecked());
+    // expose the prefetched value to php space
+    return valid() ? _prefetchedValues[_position] : nullptr;
 }
 
 /**
@@ -97,18 +154,8 @@ Php::Value PhpIterator::current()
  */
 Php::Value PhpIterator::key()
 {
-    // make sure there is a scope
-    Scope scope(_core);
-    
-    // get the keys in a local variable
-    v8::Local<v8::Array> keys(_keys.Get(_core->isolate()));
-
-    // retrieve the current key
-    auto key = keys->Get(scope, _position);
-    if (key.IsEmpty()) return nullptr;
-    
-    // retrieve the current key, the value and convert it
-    return PhpVariable(_core->isolate(), key.ToLocalChecked());
+    // expose the prefetched key to php space
+    return valid() ? _prefetchedKeys[_position] : nullptr;
 }
 
 /**
@@ -125,8 +172,11 @@ void PhpIterator::next()
  */
 void PhpIterator::rewind()
 {
-    // move back to the beginning
+    // move back to the beginning, the first chunk is fetched again
+    _cursor = 0;
     _position = 0;
+    _prefetchedKeys.clear();
+    _prefetchedValues.clear();
 }
 
 /**
@@ -3,6 +3,10 @@
  *  
  *  Class to iterate over a JS\Object. This instance is constructed
  *  by the JSObject::getIterator() method.
+ *
+ *  The keys and values are fetched and converted in chunks, so that a
+ *  foreach loop does not enter v8 for every element. The indices of arrays
+ *  are fetched as numbers, so they do not have to be converted into strings.
  * 
  *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
  *  @copyright 2025 Copernica BV
@@ -19,6 +23,7 @@
 #include <phpcpp.h>
 #include <v8.h>
 #include <core.h>
+#include <vector>
 
 /**
  *  Begin of namespace
@@ -44,23 +49,41 @@ private:
     v8::Global<v8::Object> _object;
 
     /**
-     *  All properties in the object
+     *  All properties in the object (for arrays, the indices are numbers)
      *  @var    Stack<v8::Array>
      */
     v8::Global<v8::Array> _keys;
 
     /**
-     *  Current position in the object
+     *  Position in the object of the next element to fetch
      *  @var    uint32_t
      */
-    uint32_t _position = 0;
+    uint32_t _cursor = 0;
 
     /**
-     *  Number of valid keys
+     *  Number of properties
      *  @var    uint32_t
      */
     uint32_t _size = 0;
 
+    /**
+     *  The keys and values that were fetched in advance
+     *  @var    std::vector<Php::Value>
+     */
+    std::vector<Php::Value> _prefetchedKeys;
+    std::vector<Php::Value> _prefetchedValues;
+
+    /**
+     *  Current position in the prefetched elements
+     *  @var    size_t
+     */
+    size_t _position = 0;
+
+    /**
+     *  Fetch and convert the next chunk of elements
+     */
+    void fetch();
+
 public:
     /**
      *  Constructor
@@ -17,6 +17,8 @@
 #include "php_iterator.h"
 #include "php_exception.h"
 #include "names.h"
+#include "interned.h"
+#include "php_copy.h"
 
 /**
  *  Start namespace
@@ -37,7 +39,7 @@ Php::Value PhpObject::__get(const Php::Value &name) const
     v8::Local<v8::Object> object(_object.Get(_core->isolate()).As<v8::Object>());
     
     // get the property value
-    auto property = object->Get(scope, FromPhp(_core->isolate(), name));
+    auto property = object->Get(scope, Interned::js(_core->isolate(), name));
     
     // if it does not exist, we fall back on the default behavior
     if (property.IsEmpty()) return Php::Base::__get(name);
@@ -60,7 +62,7 @@ void PhpObject::__set(const Php::Value &name, const Php::Value &property)
     v8::Local<v8::Object> object(_object.Get(_core->isolate()).As<v8::Object>());
     
     // convert the value to a ecmascript value and store it (we explicitly want to ignore the return-value)
-    object->Set(scope, FromPhp(_core->isolate(), name), FromPhp(_core->isolate(), property)).Check();
+    object->Set(scope, Interned::js(_core->isolate(), name), FromPhp(_core->isolate(), property)).Check();
 }
 
 /**
@@ -77,7 +79,7 @@ bool PhpObject::__isset(const Php::Value &name)
     v8::Local<v8::Object> object(_object.Get(_core->isolate()).As<v8::Object>());
 
     // check if the object has the requested property
-    auto result = object->Has(scope, FromPhp(_core->isolate(), name));
+    auto result = object->Has(scope, Interned::js(_core->isolate(), name));
     
     // check for success
     return result.IsJust() && result.FromJust();
@@ -213,6 +215,58 @@ Php::Iterator *PhpObject::getIterator()
     return new PhpIterator(this, _core, object);
 }
 
+/**
+ *  Convert the object into a PHP array
+ *  @param  params      optional: number of levels that are converted into arrays
+ *  @return Php::Value
+ */
+Php::Value PhpObject::toArray(Php::Parameters &params)
+{
+    // scope for the call
+    Scope scope(_core);
+
+    // catch any errors that occur while reading the properties
+    v8::TryCatch catcher(_core->isolate());
+
+    // the number of levels to convert
+    size_t depth = params.size() > 0 ? std::max<int64_t>(params[0].numericValue(), 1) : 512;
+
+    // convert the entire object in one go
+    Php::Value result = PhpCopy(_core->isolate()).value(_object.Get(_core->isolate()), depth);
+
+    // no exception
+    if (!catcher.HasCaught()) return result;
+
+    // pass this exception on to PHP userspace
+    throw PhpException(_core->isolate(), catcher);
+}
+
+/**
+ *  Convert a selection of the properties into a PHP array
+ *  @param  params      the names of the properties, and optionally the number of levels that are converted into arrays
+ *  @return Php::Value
+ */
+Php::Value PhpObject::pluck(Php::Parameters &params)
+{
+    // scope for the call
+    Scope scope(_core);
+
+    // catch any errors that occur while reading the properties
+    v8::TryCatch catcher(_core->isolate());
+
+    // the number of levels to convert
+    size_t depth = params.size() > 1 ? std::max<int64_t>(params[1].numericValue(), 0) : 0;
+
+    // convert the properties in one go
+    Php::Value result = PhpCopy(_core->isolate()).pluck(_object.Get(_core->isolate()).As<v8::Object>(), params[0], depth);
+
+    // no exception
+    if (!catcher.HasCaught()) return result;
+
+    // pass this exception on to PHP userspace
+    throw PhpException(_core->isolate(), catcher);
+}
+
 /**
  *  End namespace
  */
@@ -95,6 +95,20 @@ public:
      *  @return The iterator
      */
     virtual Php::Iterator *getIterator() override;
+
+    /**
+     *  Convert the object into a PHP array
+     *  @param  params      optional: number of levels that are converted into arrays
+     *  @return Php::Value
+     */
+    Php::Value toArray(Php::Parameters &params);
+
+    /**
+     *  Convert a selection of the properties into a PHP array
+     *  @param  params      the names of the properties, and optionally the number of levels that are converted into arrays
+     *  @return Php::Value
+     */
+    Php::Value pluck(Php::Parameters &params);
 };
 
 /**
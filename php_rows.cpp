@@ -0,0 +1,153 @@
+/**
+ *  PhpRows.cpp
+ *
+ *  Implementation file for the PhpRows class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "php_rows.h"
+#include "php_variable.h"
+#include "php_copy.h"
+#include "interned.h"
+#include "zendvalue.h"
+#include <vector>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Helper function to check if a row has the same properties as the first row
+ *  @param  context     the current context
+ *  @param  names       the property names of the row
+ *  @param  shape       the property names of the first row
+ *  @return bool
+ */
+static bool same(const v8::Local<v8::Context> &context, const v8::Local<v8::Array> &names, const std::vector<v8::Local<v8::Value>> &shape)
+{
+    // the number of properties must match
+    if (names->Length() != shape.size()) return false;
+
+    // compare the names (these are internalized, so this is normally a pointer comparison)
+    for (uint32_t i = 0; i < shape.size(); ++i)
+    {
+        // get the name
+        v8::Local<v8::Value> name;
+        if (!names->Get(context, i).ToLocal(&name) || !name->StrictEquals(shape[i])) return false;
+    }
+
+    // the row has the same shape
+    return true;
+}
+
+/**
+ *  Constructor
+ *  @param  isolate
+ *  @param  value       the value to convert (if this is not an array of objects, it is converted the normal way)
+ */
+PhpRows::PhpRows(v8::Isolate *isolate, const v8::Local<v8::Value> &value)
+{
+    // if this is not an array, there are no rows
+    if (!value->IsArray()) { _value = PhpVariable(isolate, value); return; }
+
+    // we need the context
+    auto context = isolate->GetCurrentContext();
+
+    // the array with rows
+    auto rows = value.As<v8::Array>();
+
+    // the number of rows
+    uint32_t length = rows->Length();
+
+    // the converter for rows that do not match the shape of the first row
+    PhpCopy copy(isolate);
+
+    // the property names of the first row, and the matching PHP keys
+    std::vector<v8::Local<v8::Value>> shape;
+    std::vector<Php::Value> keys;
+
+    // create the result array of the right size
+    _value = ZendValue::array(length);
+
+    // the underlying hashtable
+    HashTable *table = Z_ARRVAL_P(ZendValue::get(_value));
+
+    // iterate over the rows
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        // get the row (stop if an exception was thrown)
+        v8::Local<v8::Value> element;
+        if (!rows->Get(context, i).ToLocal(&element)) break;
+
+        // arrays can be sparse
+        if (element->IsUndefined()) continue;
+
+        // rows that are not plain objects are converted the normal way
+        if (!element->IsObject() || element->IsArray() || !PhpCopy::copyable(element.As<v8::Object>())) { ZendValue::add(table, i, copy.value(element, 1)); continue; }
+
+        // the row as object
+        auto row = element.As<v8::Object>();
+
+        // the enumerable own properties (indices are kept as numbers)
+        v8::Local<v8::Array> names;
+        if (!row->GetOwnPropertyNames(context, static_cast<v8::PropertyFilter>(v8::ONLY_ENUMERABLE | v8::SKIP_SYMBOLS), v8::KeyConversionMode::kKeepNumbers).ToLocal(&names)) break;
+
+        // the first row defines the shape
+        if (shape.empty())
+        {
+            // reserve space for the properties
+            shape.reserve(names->Length());
+            keys.reserve(names->Length());
+
+            // convert the names only once
+            for (uint32_t j = 0; j < names->Length(); ++j)
+            {
+                // get the name
+                v8::Local<v8::Value> name;
+                if (!names->Get(context, j).ToLocal(&name)) break;
+
+                // remember the name, and the PHP key (numeric, or an interned string)
+                shape.push_back(name);
+                keys.push_back(name->IsUint32() ? Php::Value(int64_t(name.As<v8::Uint32>()->Value())) : Interned::php(isolate, name.As<v8::String>()));
+            }
+        }
+
+        // rows with a different shape are converted the normal way
+        else if (!same(context, names, shape)) { ZendValue::add(table, i, copy.value(element, 1)); continue; }
+
+        // create the row of the right size
+        Php::Value result = ZendValue::array(shape.size());
+
+        // the underlying hashtable
+        HashTable *fields = Z_ARRVAL_P(ZendValue::get(result));
+
+        // iterate over the properties
+        for (size_t j = 0; j < shape.size(); ++j)
+        {
+            // get the property (stop if an exception was thrown)
+            v8::Local<v8::Value> field;
+            if (!row->Get(context, shape[j]).ToLocal(&field)) return;
+
+            // convert the value
+            PhpVariable converted(isolate, field);
+
+            // add it under the shared key
+            if (keys[j].isString()) ZendValue::add(fields, keys[j], converted);
+            else ZendValue::add(fields, keys[j].numericValue(), converted);
+        }
+
+        // add the row
+        ZendValue::add(table, i, result);
+    }
+}
+
+/**
+ *  End of namespace
+ */
+}
@@ -0,0 +1,64 @@
+/**
+ *  PhpRows.h
+ *
+ *  Class to convert a javascript array of objects that all have the same
+ *  properties (like the rows of a table) into a PHP array of arrays. The
+ *  keys are only converted for the first row, and are shared by all other
+ *  rows. Rows that have different properties are converted the normal way.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class PhpRows
+{
+private:
+    /**
+     *  The PHP value
+     *  @var Php::Value
+     */
+    Php::Value _value;
+
+public:
+    /**
+     *  Constructor
+     *  @param  isolate
+     *  @param  value       the value to convert (if this is not an array of objects, it is converted the normal way)
+     */
+    PhpRows(v8::Isolate *isolate, const v8::Local<v8::Value> &value);
+
+    /**
+     *  Destructor
+     */
+    virtual ~PhpRows() = default;
+
+    /**
+     *  Cast to the underlying PHP value
+     *  @return Php::Value
+     */
+    operator const Php::Value& () const { return _value; }
+};
+
+/**
+ *  End of namespace
+ */
+}
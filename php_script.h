@@ -91,6 +91,7 @@ public:
      *                  -   string  name of property to assign  required
      *                  -   mixed   property value to assign    required
      *                  -   integer property attributes         optional
+     *                  -   integer conversion mode             optional
      *
      *  The property attributes can be one of the following values
      *
@@ -99,14 +100,15 @@ public:
      *  - DontDelete
      *
      *  If not specified, the property will be writable, enumerable and
-     *  deletable.
+     *  deletable. The conversion mode (JS\Proxy, JS\Copy or JS\Auto)
+     *  overrides the conversion policy of the context for this value.
      * 
      *  @return Php::Value
      */
     Php::Value assign(Php::Parameters &params)
     {
         // pass on
-        _core->assign(params[0], params[1], params.size() > 2 ? params[2] : Php::Value(v8::None));
+        _core->assign(params[0], params[1], params.size() > 2 ? params[2] : Php::Value(v8::None), params.size() > 3 ? params[3] : Php::Value(nullptr));
         
         // allow chaining
         return this;
@@ -131,26 +133,26 @@ public:
 
     /**
      *  Execute script
-     *  @param  params  array with one parameter: the code to execute
+     *  @param  params  array of parameters: the timeout and the flags (both optional)
      *  @return Php::Value
      *  @throws Php::Exception
      */
     Php::Value execute(Php::Parameters &params)
     {
         // pass on
-        return _script->execute(_core, params.size() == 0 ? Php::Value(0) : params[0]);
+        return _script->execute(_core, params.size() == 0 ? Php::Value(0) : params[0], params.size() > 1 ? params[1] : Php::Value(0));
     }
     
     /**
      *  Alias for execute
-     *  @param  params  array with one parameter: the code to execute
+     *  @param  params  array of parameters: the timeout and the flags (both optional)
      *  @return Php::Value
      *  @throws Php::Exception
      */
     Php::Value __invoke(Php::Parameters &params)
     {
         // pass on
-        return _script->execute(_core, params.size() == 0 ? Php::Value(0) : params[0]);
+        return _script->execute(_core, params.size() == 0 ? Php::Value(0) : params[0], params.size() > 1 ? params[1] : Php::Value(0));
     }
 };
 
@@ -0,0 +1,142 @@
+/**
+ *  PhpString.cpp
+ *
+ *  Implementation file for the PhpString class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "php_string.h"
+#include "zendvalue.h"
+#include "latin1.h"
+#include <cstring>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Strings up to this size are first copied to the stack when they are not ascii
+ *  @var size_t
+ */
+static constexpr size_t stacksize = 1024;
+
+/**
+ *  Helper function to create a PHP string out of latin-1 characters
+ *  @param  data        the latin-1 characters
+ *  @param  size        number of characters
+ *  @param  prefix      number of leading ascii characters
+ *  @return zend_string
+ */
+static zend_string *encode(const char *data, size_t size, size_t prefix)
+{
+    // allocate a string of the exact size (the non-ascii characters take two bytes)
+    zend_string *result = zend_string_alloc(prefix + Latin1::utf8length(data + prefix, size - prefix), 0);
+
+    // copy the ascii characters, and encode the rest
+    memcpy(ZSTR_VAL(result), data, prefix);
+    Latin1::encode(data + prefix, size - prefix, ZSTR_VAL(result) + prefix);
+
+    // done
+    return result;
+}
+
+/**
+ *  Helper function to let v8 encode a javascript string in utf-8
+ *  @param  isolate
+ *  @param  input       the javascript string
+ *  @param  size        the number of bytes that are needed
+ *  @return zend_string
+ */
+static zend_string *utf8(v8::Isolate *isolate, const v8::Local<v8::String> &input, size_t size)
+{
+    // allocate a string of the exact size
+    zend_string *result = zend_string_alloc(size, 0);
+
+    // write the characters (unpaired surrogates are replaced, just like v8::String::Utf8Value does)
+    input->WriteUtf8V2(isolate, ZSTR_VAL(result), size, v8::String::WriteFlags::kReplaceInvalidUtf8);
+
+    // done
+    return result;
+}
+
+/**
+ *  Helper function to convert a one-byte javascript string
+ *  @param  isolate
+ *  @param  input       the javascript string
+ *  @return zend_string
+ */
+static zend_string *onebyte(v8::Isolate *isolate, const v8::Local<v8::String> &input)
+{
+    // number of characters
+    uint32_t length = input->Length();
+
+    // small strings are copied to the stack first, so that we only allocate once
+    if (length <= stacksize)
+    {
+        // copy the characters
+        char buffer[stacksize];
+        input->WriteOneByteV2(isolate, 0, length, reinterpret_cast<uint8_t *>(buffer));
+
+        // check how many characters are ascii
+        size_t prefix = Latin1::ascii(buffer, length);
+
+        // ascii strings can be copied as they are
+        if (prefix == length) return zend_string_init(buffer, length, 0);
+
+        // the other characters have to be encoded
+        return encode(buffer, length, prefix);
+    }
+
+    // bigger strings are measured first, so that they can be written straight into a PHP string of the right size
+    size_t size = input->Utf8LengthV2(isolate);
+
+    // if the size is not equal to the number of characters, v8 has to encode the non-ascii characters
+    if (size != length) return utf8(isolate, input, size);
+
+    // ascii strings can be copied as they are
+    zend_string *result = zend_string_alloc(length, 0);
+    input->WriteOneByteV2(isolate, 0, length, reinterpret_cast<uint8_t *>(ZSTR_VAL(result)));
+
+    // done
+    return result;
+}
+
+/**
+ *  Helper function to convert a two-byte javascript string
+ *  @param  isolate
+ *  @param  input       the javascript string
+ *  @return zend_string
+ */
+static zend_string *twobyte(v8::Isolate *isolate, const v8::Local<v8::String> &input)
+{
+    // the size has to be measured before v8 can encode the string
+    return utf8(isolate, input, input->Utf8LengthV2(isolate));
+}
+
+/**
+ *  Constructor
+ *  @param  isolate
+ *  @param  input       the javascript string
+ */
+PhpString::PhpString(v8::Isolate *isolate, const v8::Local<v8::String> &input)
+{
+    // convert the characters, depending on how v8 stores them
+    zend_string *result = input->IsOneByte() ? onebyte(isolate, input) : twobyte(isolate, input);
+
+    // PHP strings are null terminated
+    ZSTR_VAL(result)[ZSTR_LEN(result)] = '\0';
+
+    // expose the string
+    _value = ZendValue::string(result);
+}
+
+/**
+ *  End of namespace
+ */
+}
@@ -0,0 +1,63 @@
+/**
+ *  PhpString.h
+ *
+ *  Class to convert a javascript string into a PHP string. The size of the
+ *  utf-8 encoded string is calculated up front, so that the characters can
+ *  be written straight into the zend_string, without an intermediate buffer.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class PhpString
+{
+private:
+    /**
+     *  The PHP value
+     *  @var Php::Value
+     */
+    Php::Value _value;
+
+public:
+    /**
+     *  Constructor
+     *  @param  isolate
+     *  @param  input       the javascript string
+     */
+    PhpString(v8::Isolate *isolate, const v8::Local<v8::String> &input);
+
+    /**
+     *  Destructor
+     */
+    virtual ~PhpString() = default;
+
+    /**
+     *  Cast to the underlying PHP value
+     *  @return Php::Value
+     */
+    operator const Php::Value& () const { return _value; }
+};
+
+/**
+ *  End of namespace
+ */
+}
@@ -14,9 +14,14 @@
 #include "php_variable.h"
 #include "php_object.h"
 #include "php_function.h"
+#include "php_arrayobject.h"
+#include "php_generator.h"
 #include "core.h"
 #include "linker.h"
 #include "php_array.h"
+#include "php_string.h"
+#include "zendvalue.h"
+#include "numeric.h"
 #include "names.h"
 
 /**
@@ -24,6 +29,40 @@
  */
 namespace JS {
 
+/**
+ *  Helper function to convert binary data into a PHP string
+ *  @param  input       an ArrayBuffer or a view on an ArrayBuffer
+ *  @return Php::Value
+ */
+static Php::Value binary(const v8::Local<v8::Value> &input)
+{
+    // an ArrayBuffer can be copied in one go
+    if (input->IsArrayBuffer())
+    {
+        // the buffer
+        auto buffer = input.As<v8::ArrayBuffer>();
+
+        // a detached buffer has no data
+        if (buffer->ByteLength() == 0) return ZendValue::string(ZSTR_EMPTY_ALLOC());
+
+        // copy the data
+        return ZendValue::string(zend_string_init(static_cast<const char *>(buffer->Data()), buffer->ByteLength(), 0));
+    }
+
+    // the view on the buffer
+    auto view = input.As<v8::ArrayBufferView>();
+
+    // allocate a string of the right size, and copy the viewed bytes into it
+    zend_string *result = zend_string_alloc(view->ByteLength(), 0);
+    view->CopyContents(ZSTR_VAL(result), ZSTR_LEN(result));
+
+    // PHP strings are null terminated
+    ZSTR_VAL(result)[ZSTR_LEN(result)] = '\0';
+
+    // expose the string
+    return ZendValue::string(result);
+}
+
 /**
  *  Constructor
  *  @param  isolate
@@ -64,33 +103,38 @@ PhpVariable::PhpVariable(v8::Isolate *isolate, const v8::Local<v8::Value> &input
         // convert input to a string
         v8::Local<v8::String> value(v8::Local<v8::String>::Cast(input));
 
-        // convert to 
-        v8::String::Utf8Value utf8(isolate, value);
-        
-        // expose to the php value
-        _value = Php::Value(*utf8, utf8.length());
+        // expose to the php value (the characters are written straight into a php string)
+        _value = PhpString(isolate, value);
     }
     else if (input->IsStringObject())
     {
         // convert input to a string
         v8::Local<v8::StringObject> value(v8::Local<v8::StringObject>::Cast(input));
 
-        // convert to 
-        v8::String::Utf8Value utf8(isolate, value);
-        
-        // expose to the php value
-        _value = Php::Value(*utf8, utf8.length());
+        // expose the wrapped string to the php value
+        _value = PhpString(isolate, value->ValueOf());
     }
     else if (input->IsRegExp())
     {
         // convert input to a regexp
         v8::Local<v8::RegExp> value(v8::Local<v8::RegExp>::Cast(input));
 
-        // convert to 
-        v8::String::Utf8Value utf8(isolate, value);
+        // the regexp in its "/source/flags" notation
+        v8::Local<v8::String> string;
+        if (!value->ToString(isolate->GetCurrentContext()).ToLocal(&string)) return;
         
         // expose to the php value
-        _value = Php::Value(*utf8, utf8.length());
+        _value = PhpString(isolate, string);
+    }
+    else if (input->IsArrayBuffer() || input->IsUint8Array() || input->IsDataView())
+    {
+        // binary data is converted into a string with the same bytes
+        _value = binary(input);
+    }
+    else if (Numeric::supported(input))
+    {
+        // typed arrays with numbers are copied in bulk into a PHP array
+        _value = Numeric::array(input.As<v8::TypedArray>());
     }
     else if (input->IsFunction())
     {
@@ -108,11 +152,20 @@ PhpVariable::PhpVariable(v8::Isolate *isolate, const v8::Local<v8::Value> &input
     }
     else if (input->IsArray())
     {
-        // convert input to a string
+        // convert input to an array
         v8::Local<v8::Array> value(v8::Local<v8::Array>::Cast(input));
 
-        // we have a helper class for filling arrays
-        _value = PhpArray(isolate, value);
+        // unless the context is configured otherwise, we have a helper class for filling arrays
+        if (!Core::upgrade(isolate)->lazy()) { _value = PhpArray(isolate, value); return; }
+
+        // use a linker to check if the array was already associated with a php::value
+        Linker linker(isolate, value);
+
+        // if already linked
+        if (linker.valid()) _value = linker.value();
+
+        // otherwise we wrap the array in an object that reads the elements on demand
+        else _value = linker.attach(Php::Object(Names::Array, new PhpArrayObject(isolate, value)));
     }
     else if (input->IsObject())
     {
@@ -123,10 +176,14 @@ PhpVariable::PhpVariable(v8::Isolate *isolate, const v8::Local<v8::Value> &input
         Linker linker(isolate, object);
         
         // if already linked
-        if (linker.valid()) _value = linker.value();
+        if (linker.valid()) { _value = linker.value(); return; }
+
+        // iterators (like generators) are streamed into PHP one element at a time
+        auto next = PhpGenerator::next(isolate, object);
+        if (!next.IsEmpty()) { _value = linker.attach(Php::Object(Names::Iterator, new PhpGenerator(isolate, object, next))); return; }
 
         // otherwise we associate the object now
-        else _value = linker.attach(Php::Object(Names::Object, new PhpObject(isolate, object)));
+        _value = linker.attach(Php::Object(Names::Object, new PhpObject(isolate, object)));
     }
 }
 
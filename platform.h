@@ -68,6 +68,12 @@ public:
      *  Cleanup the platform instance
      */
     static void shutdown();
+    
+    /**
+     *  The underlying v8 platform
+     *  @return v8::Platform
+     */
+    v8::Platform *platform() const { return _platform.get(); }
 };
 
 /**
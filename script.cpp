@@ -15,6 +15,8 @@
 #include "scope.h"
 #include "php_exception.h"
 #include "php_variable.h"
+#include "php_rows.h"
+#include "php_string.h"
 
 /**
  *  Begin of namespace
@@ -53,14 +55,42 @@ Script::Script(const std::shared_ptr<Core> &core, const char *source)
     else throw PhpException(core->isolate(), catcher);
 }
 
+/**
+ *  Helper function to convert the result of a script into JSON
+ *  @param  isolate
+ *  @param  context
+ *  @param  value       the result of the script
+ *  @return Php::Value
+ *  @throws Php::Exception
+ */
+static Php::Value json(v8::Isolate *isolate, const v8::Local<v8::Context> &context, const v8::Local<v8::Value> &value)
+{
+    // values that have no JSON representation
+    if (value->IsUndefined() || value->IsFunction() || value->IsSymbol()) return nullptr;
+
+    // for catching errors (like cyclic structures)
+    v8::TryCatch catcher(isolate);
+
+    // turn the value into JSON
+    v8::Local<v8::String> result;
+    if (v8::JSON::Stringify(context, value).ToLocal(&result)) return PhpString(isolate, result);
+
+    // there may not be a message if the error was not thrown by a script
+    if (catcher.Message().IsEmpty()) throw Php::Exception("Result cannot be converted into JSON");
+
+    // pass the exception on to PHP userspace
+    throw PhpException(isolate, catcher);
+}
+
 /**
  *  Execute the script
  *  @param  core
  *  @param  timeout
+ *  @param  flags       bitmask of flags for converting the result
  *  @return Php::Value
  *  @throws Php::Exception
  */
-Php::Value Script::execute(const std::shared_ptr<Core> &core, time_t timeout)
+Php::Value Script::execute(const std::shared_ptr<Core> &core, time_t timeout, int flags)
 {
     // create a scope
     Scope scope(core);
@@ -81,7 +111,23 @@ Php::Value Script::execute(const std::shared_ptr<Core> &core, time_t timeout)
     auto result = script->Run(scope);
 
     // if no exception occured we're done
-    if (!catcher.HasCaught()) return result.IsEmpty() ? Php::Value(nullptr) : PhpVariable(isolate, result.ToLocalChecked());
+    if (!catcher.HasCaught() && result.IsEmpty()) return nullptr;
+
+    // the result can be returned as JSON, so that PHP can decode it (or pass it on) itself
+    if (!catcher.HasCaught() && (flags & AsJson)) return json(isolate, scope, result.ToLocalChecked());
+
+    // an array of objects with the same properties can be converted into rows
+    if (!catcher.HasCaught() && (flags & AsRows))
+    {
+        // convert the rows (a getter may throw while the properties are read)
+        Php::Value rows = PhpRows(isolate, result.ToLocalChecked());
+
+        // no exception
+        if (!catcher.HasCaught()) return rows;
+    }
+
+    // or it is converted the normal way
+    if (!catcher.HasCaught()) return PhpVariable(isolate, result.ToLocalChecked());
 
     // if we have terminated we just throw a fixed error message as the catcher.Message()
     // method won't return anything useful (in fact it'll return nothing meaning we just segfault)
@@ -26,6 +26,15 @@ namespace JS {
  */
 class Script
 {
+public:
+    /**
+     *  Flags to change how the result is converted
+     */
+    enum Flags {
+        AsRows  =   1,
+        AsJson  =   2
+    };
+
 private:
     /**
      *  The compiled script, not bound to a context. This allows us to reset the context between calls
@@ -59,10 +68,11 @@ public:
      *  Execute the script
      *  @param  core
      *  @param  timeout
+     *  @param  flags       bitmask of flags for converting the result
      *  @return Php::Value
      *  @throws Php::Exception
      */
-    Php::Value execute(const std::shared_ptr<Core> &core, time_t timeout);
+    Php::Value execute(const std::shared_ptr<Core> &core, time_t timeout, int flags = 0);
 };
 
 /**
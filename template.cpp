@@ -18,6 +18,9 @@
 #include "fromiterator.h"
 #include "php_array.h"
 #include "exception.h"
+#include "interned.h"
+#include "zendvalue.h"
+#include "arraymethods.h"
 
 /**
  *  Begin of namespace
@@ -42,6 +45,9 @@ Template::Template(v8::Isolate *isolate) : _isolate(isolate)
         nullptr                                                   // enumerate over an object
     ));
 
+    // reserve internal fields, so that the PHP variable can be found without a property lookup
+    tpl->SetInternalFieldCount(Linker::fields);
+
     // make sure handler is preserved
     _template.Reset(isolate, tpl);
 }
@@ -84,6 +90,9 @@ Template::Template(v8::Isolate *isolate, const Php::Value &value) :
     // when object is callable, we need to install a callback too
     if (_callable) tpl->SetCallAsFunctionHandler(&Template::call);
     
+    // reserve internal fields, so that the PHP variable can be found without a property lookup
+    tpl->SetInternalFieldCount(Linker::fields);
+
     // make sure handler is preserved
     _template.Reset(isolate, tpl);
 }
@@ -136,7 +145,7 @@ v8::Local<v8::Value> Template::apply(const Php::Value &value) const
     Linker linker(_isolate, object);
     
     // attach the objects
-    linker.attach(value, false);
+    linker.wrap(value);
 
     // get the object
     return object;
@@ -167,11 +176,14 @@ v8::Intercepted Template::getProperty(v8::Local<v8::Name> property, const v8::Pr
     // we expect an object or array now
     if (!object.isObject() && !object.isArray()) return v8::Intercepted::kNo;
     
-    // convert to a utf8value to get the actual c-string
+    // the property as string
     v8::Local<v8::String> prop = property.As<v8::String>();
 
-    // for use as c_str    
-    v8::String::Utf8Value name(isolate, prop);
+    // the name in PHP space (hot names are interned, so this does not allocate)
+    Php::Value name = Interned::php(isolate, prop);
+    
+    // the PHP string holding the name (including a precomputed hash)
+    zend_string *key = Z_STR_P(ZendValue::get(name));
     
     /**
      *  This is where it gets a little weird.
@@ -199,16 +211,59 @@ v8::Intercepted Template::getProperty(v8::Local<v8::Name> property, const v8::Pr
     // avoid exceptions
     try
     {
+        // arrays have no methods, so we can look up the key straight away
+        if (object.isArray())
+        {
+            // look up the element (this uses the precomputed hash of the key)
+            zval *element = zend_symtable_find(Z_ARRVAL_P(ZendValue::get(object)), key);
+            
+            // if found, we convert it to a javascript handle
+            if (element != nullptr)
+            {
+                // the array may hold a reference
+                ZVAL_DEREF(element);
+                
+                // convert it to a javascript handle and return it
+                info.GetReturnValue().Set(FromPhp(isolate, Php::Value(element)));
+                
+                // handled
+                return v8::Intercepted::kYes;
+            }
+            
+            // the length of the array can be served straight from the hashtable
+            if (zend_string_equals_literal(key, "length"))
+            {
+                // number of elements in the array
+                info.GetReturnValue().Set(v8::Integer::NewFromUnsigned(isolate, zend_hash_num_elements(Z_ARRVAL_P(ZendValue::get(object)))));
+                
+                // handled
+                return v8::Intercepted::kYes;
+            }
+            
+            // some methods of Array.prototype are implemented natively
+            auto method = ArrayMethods::lookup(isolate, key);
+            
+            // if found, we return the function
+            if (!method.IsEmpty())
+            {
+                // expose the method
+                info.GetReturnValue().Set(method);
+                
+                // handled
+                return v8::Intercepted::kYes;
+            }
+        }
+        
         // does the method exist, is it callable or is it a property
-        bool method_exists  = object.isObject() && Php::call("method_exists", object, *name);
-        bool is_callable    = object.isCallable(*name);
-        bool contains       = object.contains(*name, name.length());
+        bool method_exists  = object.isObject() && Php::call("method_exists", object, name);
+        bool is_callable    = object.isObject() && object.isCallable(ZSTR_VAL(key));
+        bool contains       = object.isObject() && object.contains(ZSTR_VAL(key), ZSTR_LEN(key));
         
         // does a property exist by the given name and is it not defined as a method?
         if (contains && !method_exists)
         {
             // get the object property value
-            FromPhp value(isolate, object.get(*name, name.length()));
+            FromPhp value(isolate, object.get(ZSTR_VAL(key), ZSTR_LEN(key)));
             
             // convert it to a javascript handle and return it
             info.GetReturnValue().Set(value);
@@ -217,7 +272,7 @@ v8::Intercepted Template::getProperty(v8::Local<v8::Name> property, const v8::Pr
             return v8::Intercepted::kYes;
         }
         // is it a countable object we want the length off?
-        else if (std::strcmp(*name, "length") == 0 && (object.instanceOf("Countable") || object.isArray()))
+        else if (zend_string_equals_literal(key, "length") && (object.instanceOf("Countable") || object.isArray()))
         {
             // return the count from this object
             info.GetReturnValue().Set(FromPhp(isolate, Php::call("count", object)));
@@ -225,10 +280,10 @@ v8::Intercepted Template::getProperty(v8::Local<v8::Name> property, const v8::Pr
             // handled
             return v8::Intercepted::kYes;
         }
-        else if (object.instanceOf("ArrayAccess") && object.call("offsetExists", *name))
+        else if (object.instanceOf("ArrayAccess") && object.call("offsetExists", name))
         {
             // get the object property value
-            FromPhp value(isolate, object.call("offsetGet", *name));
+            FromPhp value(isolate, object.call("offsetGet", name));
 
             // use the array access to retrieve the property
             info.GetReturnValue().Set(value);
@@ -236,7 +291,7 @@ v8::Intercepted Template::getProperty(v8::Local<v8::Name> property, const v8::Pr
             // handled
             return v8::Intercepted::kYes;
         }
-        else if (object.isCallable("__toString") && (std::strcmp(*name, "valueOf") == 0 || std::strcmp(*name, "toString") == 0))
+        else if ((zend_string_equals_literal(key, "valueOf") || zend_string_equals_literal(key, "toString")) && object.isCallable("__toString"))
         {
             // handle the to-string conversion
             return getString(info);
@@ -350,49 +405,55 @@ v8::Intercepted Template::getIterator(const v8::PropertyCallbackInfo<v8::Value>
     // if it is not iterable
     if (!object.instanceOf("Traversable") && !object.isArray()) return v8::Intercepted::kNo;
             
-    // an iterator should be a function
-    auto func = v8::Function::New(scope, [](const v8::FunctionCallbackInfo<v8::Value>& info) {
+    // the iterator method is the same function for all arrays and objects
+    info.GetReturnValue().Set(FromIterator::method(isolate));
+    
+    // this has been handled by us
+    return v8::Intercepted::kYes;
+}
 
-        // we need the isolate
-        auto *isolate = info.GetIsolate();
+/**
+ *  Helper function to look up an element in a hashtable by its index. Lists
+ *  are stored as packed arrays, in which the element can be found by its offset
+ *  @param  table       the hashtable
+ *  @param  index       the index to look up
+ *  @return zval*       nullptr when not found
+ */
+static zval *find(HashTable *table, uint32_t index)
+{
+    // the element that we find
+    zval *element = nullptr;
+    
+    // for packed arrays the index is the offset in the table
+    if (HT_IS_PACKED(table))
+    {
+        // out of range
+        if (index >= table->nNumUsed) return nullptr;
         
-        // create a handlescope
-        Scope scope(isolate);
+        // the element in the table
+#if PHP_VERSION_ID >= 80200
+        element = &table->arPacked[index];
+#else
+        element = &table->arData[index].val;
+#endif
+
+        // there could be a hole in the array
+        if (Z_ISUNDEF_P(element)) return nullptr;
+    }
+    else
+    {
+        // do a regular hash lookup
+        element = zend_hash_index_find(table, index);
         
-        // avoid exceptions
-        try
-        {
-            // get original php object
-            Php::Value object = Linker(isolate, info.This()).value();
-            
-            // the retval that needs updating
-            auto retval = info.GetReturnValue();
-            
-            // if the object is already traversable
-            if (object.instanceOf("Iterator")) retval.Set(FromIterator(isolate, object).value());
-            
-            // of a can indirectly retrieve the iterator?
-            else if (object.instanceOf("IteratorAggregate")) retval.Set(FromIterator(isolate, object.call("getIterator")).value());
-            
-            // arrays themselves can be iterated
-            else if (object.isArray()) retval.Set(FromIterator(isolate, Php::Object("ArrayIterator", object)).value());
-            
-            // this should not happen
-            else retval.Set(FromIterator(isolate, Php::Object("EmptyIterator")).value());
-        }
-        catch (const Php::Exception &exception)
-        {
-            // pass the exception on to javascript userspace
-            isolate->ThrowException(Exception(isolate, exception));
-        }
-
-    }).ToLocalChecked();
-
-    // use the array access to retrieve the property
-    info.GetReturnValue().Set(func);
+        // not found
+        if (element == nullptr) return nullptr;
+    }
     
-    // this has been handled by us
-    return v8::Intercepted::kYes;
+    // the array may hold a reference
+    ZVAL_DEREF(element);
+    
+    // expose the element
+    return element;
 }
 
 /**
@@ -416,13 +477,16 @@ v8::Intercepted Template::getIndex(unsigned index, const v8::PropertyCallbackInf
         Php::Value object = Linker(isolate, info.This()).value();
         
         // is the underlying variable an array?
-        if (object.isArray() && object.contains(index))
+        if (object.isArray())
         {
-            // make the call
-            FromPhp value(isolate, object.get(static_cast<int64_t>(index)));
-
+            // look up the element straight in the hashtable
+            zval *element = find(Z_ARRVAL_P(ZendValue::get(object)), index);
+            
+            // not found in the array
+            if (element == nullptr) return v8::Intercepted::kNo;
+            
             // set the result
-            info.GetReturnValue().Set(v8::Global<v8::Value>(isolate, value));
+            info.GetReturnValue().Set(FromPhp(isolate, Php::Value(element)));
 
             // call was handled
             return v8::Intercepted::kYes;
@@ -435,7 +499,7 @@ v8::Intercepted Template::getIndex(unsigned index, const v8::PropertyCallbackInf
             FromPhp value(isolate, object.call("offsetGet", static_cast<int64_t>(index)));
 
             // set the result
-            info.GetReturnValue().Set(v8::Global<v8::Value>(isolate, value));
+            info.GetReturnValue().Set(value);
             
             // call was handled
             return v8::Intercepted::kYes;
@@ -474,11 +538,14 @@ v8::Intercepted Template::setProperty(v8::Local<v8::Name> property, v8::Local<v8
         // the object that is being accessed
         Php::Value object = Linker(isolate, info.This()).value();
 
+        // the name of the property (hot names are interned)
+        Php::Value name = property->IsString() ? Interned::php(isolate, property) : Php::Value(PhpVariable(isolate, property));
+
         // if the underlying variable is an array, or when there is no ArrayAccess implemented, we set the property the regular way
-        if (object.isArray() || !object.instanceOf("ArrayAccess")) object.set(PhpVariable(isolate, property), PhpVariable(isolate, input));
+        if (object.isArray() || !object.instanceOf("ArrayAccess")) object.set(name, PhpVariable(isolate, input));
 
         // there is an ArrayAccess interface so we go through offsetSet()
-        else object.call("offsetSet", PhpVariable(isolate, property), PhpVariable(isolate, input));
+        else object.call("offsetSet", name, PhpVariable(isolate, input));
     }
     catch (const Php::Exception &exception)
     {
@@ -0,0 +1,122 @@
+/**
+ *  TemplateCache.cpp
+ *
+ *  Implementation file for the TemplateCache class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "templatecache.h"
+#include <phpcpp.h>
+#include <php.h>
+#include <algorithm>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  The entries, the most recently used entry comes first
+ *  @var std::list<Entry>
+ */
+std::list<TemplateCache::Entry> TemplateCache::_entries;
+
+/**
+ *  The entries, indexed by class
+ *  @var std::unordered_map
+ */
+std::unordered_map<zend_class_entry *, std::list<TemplateCache::Entry>::iterator> TemplateCache::_index;
+
+/**
+ *  Counters for the lookups
+ *  @var size_t
+ */
+size_t TemplateCache::_hits = 0;
+size_t TemplateCache::_misses = 0;
+size_t TemplateCache::_evictions = 0;
+
+/**
+ *  Look up the template for a class
+ *  @param  ce          the class
+ *  @return Template    nullptr if the class is not in the cache
+ */
+const Template *TemplateCache::find(zend_class_entry *ce)
+{
+    // look up the class
+    auto iter = _index.find(ce);
+
+    // not found
+    if (iter == _index.end()) return ++_misses, nullptr;
+
+    // move the entry to the front, because it was used most recently
+    _entries.splice(_entries.begin(), _entries, iter->second);
+
+    // found
+    return ++_hits, iter->second->tpl;
+}
+
+/**
+ *  Remember the template for a class
+ *  @param  ce          the class
+ *  @param  tpl         the template
+ */
+void TemplateCache::store(zend_class_entry *ce, const Template *tpl)
+{
+    // the maximum number of classes (zero to disable the cache)
+    size_t capacity = std::max(Php::ini_get("js.template_cache").numericValue(), int64_t(0));
+
+    // remove the classes that were used the longest time ago
+    while (!_entries.empty() && _entries.size() >= capacity)
+    {
+        // forget the last entry
+        _index.erase(_entries.back().ce);
+        _entries.pop_back();
+
+        // one more eviction
+        ++_evictions;
+    }
+
+    // is the cache disabled?
+    if (capacity == 0) return;
+
+    // add the entry to the front
+    _entries.push_front(Entry{ ce, tpl });
+    _index[ce] = _entries.begin();
+}
+
+/**
+ *  Forget the classes that were declared by PHP scripts (called at the end of each request)
+ */
+void TemplateCache::invalidate()
+{
+    // check all entries
+    for (auto iter = _entries.begin(); iter != _entries.end(); )
+    {
+        // internal classes live as long as the process
+        if (iter->ce->type != ZEND_USER_CLASS) { ++iter; continue; }
+
+        // forget the class
+        _index.erase(iter->ce);
+        iter = _entries.erase(iter);
+    }
+}
+
+/**
+ *  Forget all classes (called when the templates are destructed)
+ */
+void TemplateCache::reset()
+{
+    // forget everything
+    _entries.clear();
+    _index.clear();
+}
+
+/**
+ *  End of namespace
+ */
+}
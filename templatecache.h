@@ -0,0 +1,134 @@
+/**
+ *  TemplateCache.h
+ *
+ *  Finding the template for a PHP object requires a couple of checks on the
+ *  object (is it ArrayAccess, is it callable?) for every template that we
+ *  have. The outcome only depends on the class, so the template that was
+ *  found is remembered per class.
+ *
+ *  The number of classes is bounded by the "js.template_cache" setting: when
+ *  the cache is full, the class that was used the longest time ago is
+ *  evicted. Classes that are declared by PHP scripts only live for a single
+ *  request (and a new class may later be declared at the same address), so
+ *  they are invalidated at the end of each request.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <unordered_map>
+#include <list>
+#include <cstddef>
+
+/**
+ *  Forward declarations
+ */
+struct _zend_class_entry;
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Forward declarations
+ */
+class Template;
+
+/**
+ *  Class definition
+ */
+class TemplateCache
+{
+private:
+    /**
+     *  An entry in the cache
+     */
+    struct Entry
+    {
+        /**
+         *  The class
+         *  @var zend_class_entry
+         */
+        struct _zend_class_entry *ce;
+
+        /**
+         *  The template for objects of this class
+         *  @var Template
+         */
+        const Template *tpl;
+    };
+
+    /**
+     *  The entries, the most recently used entry comes first
+     *  @var std::list<Entry>
+     */
+    static std::list<Entry> _entries;
+
+    /**
+     *  The entries, indexed by class
+     *  @var std::unordered_map
+     */
+    static std::unordered_map<struct _zend_class_entry *, std::list<Entry>::iterator> _index;
+
+    /**
+     *  Counters for the lookups: classes that were found, that were not found,
+     *  and that were evicted because the cache was full
+     *  @var size_t
+     */
+    static size_t _hits;
+    static size_t _misses;
+    static size_t _evictions;
+
+public:
+    /**
+     *  Look up the template for a class
+     *  @param  ce          the class
+     *  @return Template    nullptr if the class is not in the cache
+     */
+    static const Template *find(struct _zend_class_entry *ce);
+
+    /**
+     *  Remember the template for a class
+     *  @param  ce          the class
+     *  @param  tpl         the template
+     */
+    static void store(struct _zend_class_entry *ce, const Template *tpl);
+
+    /**
+     *  Forget the classes that were declared by PHP scripts (called at the end of each request)
+     */
+    static void invalidate();
+
+    /**
+     *  Forget all classes (called when the templates are destructed)
+     */
+    static void reset();
+
+    /**
+     *  Number of classes in the cache
+     *  @return size_t
+     */
+    static size_t size() { return _entries.size(); }
+
+    /**
+     *  The counters
+     *  @return size_t
+     */
+    static size_t hits() { return _hits; }
+    static size_t misses() { return _misses; }
+    static size_t evictions() { return _evictions; }
+};
+
+/**
+ *  End of namespace
+ */
+}
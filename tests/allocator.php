@@ -0,0 +1,49 @@
+<?php
+/**
+ *  Allocator.php
+ *
+ *  Check the allocator for array buffers: small buffers are pooled, and
+ *  allocations beyond the limit fail (the setting is read when the first
+ *  context is created)
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+ini_set('js.buffer_limit', 16 * 1024 * 1024);
+
+$context = new JS\Context();
+
+// small buffers are taken from the pools
+var_dump($context->evaluate("let n = 0; for (let i = 0; i < 1000; i++) n += new Uint8Array(64).length; n"));
+
+// a buffer that is bigger than the limit
+try
+{
+    $context->evaluate("new ArrayBuffer(32 * 1024 * 1024)");
+}
+catch (Exception $exception)
+{
+    echo("Error: ".$exception->getMessage()."\n");
+}
+
+// typed arrays and buffers that are created from PHP data throw an exception too
+try
+{
+    $context->assignNumeric('numbers', range(1, 3 * 1024 * 1024));
+}
+catch (Exception $exception)
+{
+    echo("Error: ".$exception->getMessage()."\n");
+}
+try
+{
+    $context->assign('bytes', new JS\Buffer(str_repeat('x', 32 * 1024 * 1024)));
+}
+catch (Exception $exception)
+{
+    echo("Error: ".$exception->getMessage()."\n");
+}
+
+$statistics = $context->statistics();
+var_dump($statistics['buffer_peak'] > 0, $statistics['buffer_peak'] <= 16 * 1024 * 1024);
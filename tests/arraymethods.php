@@ -0,0 +1,20 @@
+<?php
+/**
+ *  ArrayMethods.php
+ *
+ *  Check the native map, filter, reduce and forEach methods on PHP arrays
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+$context->assign('list', range(1, 1000));
+$context->assign('map', ['a' => 1, 10 => 2, 'c' => 3]);
+
+var_dump($context->evaluate("list.map(x => x * 2).filter(x => x % 3 == 0).reduce((a, b) => a + b, 0)"));
+
+var_dump($context->evaluate("let keys = []; map.forEach((v, k) => keys.push(k)); keys.join(',')"));
+var_dump($context->evaluate("map.reduce((a, b) => a + b)"));
+var_dump($context->evaluate("[...map].join(',')"));
+var_dump($context->evaluate("try { map.filter(123) } catch (e) { e.message }"));
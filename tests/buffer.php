@@ -0,0 +1,40 @@
+<?php
+/**
+ *  Buffer.php
+ *
+ *  Test for passing binary data between PHP and javascript
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+// binary data with all possible bytes
+$data = '';
+for ($i = 0; $i < 256; $i++) $data .= chr($i);
+
+$context = new JS\Context();
+
+// the buffer becomes a Uint8Array
+$context->assign('small', new JS\Buffer($data));
+var_dump($context->evaluate("small instanceof Uint8Array && small.length == 256 && small[255] == 255"));
+
+// and comes back as the same bytes
+var_dump($context->evaluate("small") === $data);
+
+// array buffers and data views are converted too
+var_dump($context->evaluate("small.buffer") === $data);
+var_dump($context->evaluate("new DataView(small.buffer, 16, 16)") === substr($data, 16, 16));
+var_dump($context->evaluate("small.subarray(200)") === substr($data, 200));
+
+// buffers created in javascript
+var_dump($context->evaluate("new Uint8Array([104, 105])") === "hi");
+
+// large buffers
+$large = str_repeat($data, 4096);
+$context->assign('large', new JS\Buffer($large));
+var_dump($context->evaluate("large.length") == strlen($large));
+var_dump($context->evaluate("large") === $large);
+
+// the buffer itself is still a string in PHP
+$buffer = new JS\Buffer("abc");
+var_dump((string)$buffer === "abc", count($buffer));
@@ -0,0 +1,33 @@
+<?php
+/**
+ *  Conversion.php
+ *
+ *  Check the policy for converting PHP arrays and objects into javascript
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+class Point implements JsonSerializable
+{
+    public function __construct(private int $x, private int $y) {}
+    public function jsonSerialize(): mixed { return ['x' => $this->x, 'y' => $this->y]; }
+}
+
+$config = ['debug' => true, 'levels' => [1, 2, 3], 'origin' => new Point(1, 2)];
+
+$context = new JS\Context();
+$context->setConversion(JS\Auto, 16, 4);
+$context->assign('config', $config);
+$context->assign('big', range(1, 100));
+$context->assign('proxied', $config, JS\None, JS\Proxy);
+
+var_dump($context->evaluate("Array.isArray(config.levels) && config.origin.y == 2"));
+var_dump($context->evaluate("Array.isArray(big)"));
+var_dump($context->evaluate("Array.isArray(proxied.levels)"));
+
+var_dump($context->evaluate("let sum = 0; for (let i = 0; i < 1000; i++) sum += config.levels[i % 3]; sum"));
+
+// small arrays are copied, the large one and the explicit proxy are proxied
+$statistics = $context->statistics();
+var_dump($statistics['copied'] > 0, $statistics['proxied'] > 0);
@@ -0,0 +1,28 @@
+<?php
+/**
+ *  Cppgc.php
+ *
+ *  Check wrapping PHP objects with wrappers on the C++ heap of v8 (the
+ *  setting is read when the first context is created)
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+ini_set('js.cppgc_wrappers', true);
+
+$context = new JS\Context();
+
+$context->assign('create', function($i) {
+    $object = new stdClass;
+    $object->id = $i;
+    return $object;
+});
+
+var_dump($context->evaluate("let sum = 0; for (let i = 0; i < 1000; i++) sum += create(i).id; sum"));
+
+// the same PHP object is returned when the wrapper is passed back
+$object = new stdClass;
+$context->assign('object', $object);
+var_dump($context->evaluate("object") === $object);
+var_dump($context->statistics()['wrappers'] > 0);
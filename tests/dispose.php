@@ -0,0 +1,52 @@
+<?php
+/**
+ *  Dispose.php
+ *
+ *  Check releasing a context right away, objects that still refer to the
+ *  context throw an exception when they are used
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+for ($i = 0; $i < 10; $i++)
+{
+    $context = new JS\Context();
+    $context->assign('tenant', ['id' => $i, 'data' => range(1, 1000)]);
+    $object = $context->evaluate("({ id: tenant.id, total: tenant.data.length })");
+    $context->dispose();
+}
+
+// the object of the last context can no longer be used
+try
+{
+    var_dump($object->id);
+}
+catch (Exception $exception)
+{
+    echo("Error: ".$exception->getMessage()."\n");
+}
+
+// and neither can the context itself
+try
+{
+    $context->evaluate("1 + 1");
+}
+catch (Exception $exception)
+{
+    echo("Error: ".$exception->getMessage()."\n");
+}
+
+// PHP variables that are only referred to by javascript are released right away
+class Resource
+{
+    public $name;
+    public function __construct($name) { $this->name = $name; }
+    public function __destruct() { echo("destructed: {$this->name}\n"); }
+}
+$context = new JS\Context();
+$context->assign('resource', new Resource('object'));
+$context->assignFunction('callback', function() { static $resource; $resource = new Resource('function'); });
+$context->evaluate("callback()");
+$context->dispose();
+echo("disposed\n");
@@ -0,0 +1,21 @@
+<?php
+/**
+ *  ExternalMemory.php
+ *
+ *  Check that PHP arrays that are kept alive by javascript objects are
+ *  released in time, because v8 knows about the memory that they use
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+$context->assign('load', function() {
+    return range(1, 10000);
+});
+
+var_dump($context->evaluate("let sum = 0; for (let i = 0; i < 2000; i++) sum += load().length; sum"));
+
+// the arrays that are no longer used are released along the way
+var_dump(memory_get_peak_usage() < 2000 * 10000 * 16);
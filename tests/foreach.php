@@ -0,0 +1,38 @@
+<?php
+/**
+ *  Foreach.php
+ *
+ *  Check iterating over javascript objects and arrays with foreach
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+ini_set('js.lazy_arrays', true);
+
+$context = new JS\Context();
+
+// an object with more properties than fit in one chunk
+$object = $context->evaluate("(function() { const o = {}; for (let i = 0; i < 200; i++) o['key' + i] = i; return o; })()");
+$count = 0; $sum = 0;
+foreach ($object as $key => $value) { $count++; $sum += $value; }
+var_dump($count, $sum, $key);
+
+// an array with more elements than fit in one chunk
+$array = $context->evaluate("Array.from({ length: 1000 }, (_, i) => i)");
+$count = 0; $sum = 0;
+foreach ($array as $key => $value) { $count++; $sum += $value; }
+var_dump($count, $sum, $key);
+
+// holes are skipped, and iterating twice starts over
+$sparse = $context->evaluate("const a = [1, , 3]; a[70] = 'last'; a");
+foreach ($sparse as $key => $value) echo("$key: ".json_encode($value)."\n");
+foreach ($sparse as $key => $value) echo("$key: ".json_encode($value)."\n");
+
+// properties that are not indices are included too
+$named = $context->evaluate("const b = [1, 2]; b.name = 'named'; b");
+foreach ($named as $key => $value) echo("$key: ".json_encode($value)."\n");
+
+// a huge sparse array only visits the elements that exist
+$huge = $context->evaluate("const c = []; c[4000000000] = 'far'; c");
+foreach ($huge as $key => $value) echo("$key: ".json_encode($value)."\n");
@@ -0,0 +1,47 @@
+<?php
+/**
+ *  Function.php
+ *
+ *  Check if PHP callables can be assigned as real javascript functions
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+/**
+ *  Function with an explicit signature
+ */
+$context->assignFunction('add', function($x, $y) {
+    return $x + $y;
+}, ['int', 'int']);
+
+/**
+ *  Function with a signature that is derived from the declaration
+ */
+$context->assignFunction('greet', function(string $name, bool $loud) {
+    return $loud ? strtoupper("hello $name") : "hello $name";
+});
+
+/**
+ *  Check the behavior
+ */
+var_dump($context->evaluate("typeof add"));
+var_dump($context->evaluate("add.length"));
+var_dump($context->evaluate("add('1', 2.7)"));
+var_dump($context->evaluate("greet(123, 1)"));
+var_dump($context->evaluate("greet.name"));
+
+// missing arguments are converted from undefined
+var_dump($context->evaluate("add(5)"));
+var_dump($context->evaluate("greet()"));
+
+// missing optional arguments get the PHP default values, and are not part of the arity
+$context->assignFunction('scale', function(int $x, int $factor = 10, string $unit = 'px') {
+    return ($x * $factor).$unit;
+});
+var_dump($context->evaluate("scale.length"));
+var_dump($context->evaluate("scale(2)"));
+var_dump($context->evaluate("scale(2, 3)"));
+var_dump($context->evaluate("scale(2, 3, 'em')"));
@@ -0,0 +1,48 @@
+<?php
+/**
+ *  Generator.php
+ *
+ *  Check streaming javascript generators and iterators into PHP
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+// a generator that produces many rows, one at a time
+$rows = $context->evaluate("(function*() { for (let i = 0; i < 1000; i++) yield { id: i }; })()");
+var_dump($rows instanceof JS\Iterator);
+$count = 0;
+foreach ($rows as $key => $row) $count++;
+var_dump($count, $key);
+
+// the iterators of builtin collections
+foreach ($context->evaluate("new Set(['a', 'b', 'c']).values()") as $key => $value) echo("$key: $value\n");
+foreach ($context->evaluate("['x', 'y'].entries()") as $key => $value) echo("$key: ".json_encode($value)."\n");
+
+// a hand-written object with a next() method remains a regular object
+$iterator = $context->evaluate("({ n: 0, next() { return this.n < 3 ? { value: this.n++, done: false } : { done: true } }, [Symbol.iterator]() { return this; } })");
+var_dump($iterator instanceof JS\Iterator, $iterator->n);
+
+// converting objects does not run getters or proxy traps
+$context->evaluate("var touched = 0");
+$context->evaluate("({ get [Symbol.toStringTag]() { touched++; return 'Array Iterator'; } })");
+$context->evaluate("new Proxy({}, { get() { touched++; } })");
+var_dump($context->evaluate("touched"));
+
+// breaking out of the loop runs the finally block of the generator
+$context->assign('log', function($message) { echo("$message\n"); });
+$numbers = $context->evaluate("(function*() { try { yield 1; yield 2; yield 3; } finally { log('finally'); } })()");
+foreach ($numbers as $value) { echo("$value\n"); if ($value == 2) break; }
+unset($numbers);
+
+// errors thrown by the generator become PHP exceptions
+try
+{
+    foreach ($context->evaluate("(function*() { yield 1; throw new Error('failed'); })()") as $value) echo("$value\n");
+}
+catch (Exception $exception)
+{
+    echo("Error: ".$exception->getMessage()."\n");
+}
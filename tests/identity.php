@@ -0,0 +1,28 @@
+<?php
+/**
+ *  Identity.php
+ *
+ *  Check if the same PHP object always turns into the same javascript object
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+class Order
+{
+    public $customer;
+    public function __construct() { $this->customer = new stdClass(); }
+}
+
+$context = new JS\Context();
+$order = new Order();
+
+$context->assign('a', $order);
+$context->assign('b', $order);
+
+/**
+ *  All should be true
+ */
+var_dump($context->evaluate("a === b"));
+var_dump($context->evaluate("a.customer === b.customer"));
+var_dump($context->evaluate("a.customer === a.customer"));
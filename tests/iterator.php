@@ -0,0 +1,45 @@
+<?php
+/**
+ *  Iterator.php
+ *
+ *  Check iterating over PHP arrays, iterators and generators in javascript
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+// sum all values
+$context->evaluate("function sum(iterable) { var total = 0; for (var x of iterable) total += x; return total; }");
+
+// arrays (also the last element should be included)
+$context->assign('array', [1, 2, 3, 4]);
+var_dump($context->evaluate("sum(array)"));
+
+// associative arrays iterate over the values
+$context->assign('assoc', ['a' => 1, 'b' => 2]);
+var_dump($context->evaluate("[...assoc].join(',')"));
+
+// internal iterators
+$context->assign('iterator', new ArrayIterator([5, 6, 7]));
+var_dump($context->evaluate("sum(iterator)"));
+
+// aggregates
+$context->assign('aggregate', new ArrayObject([8, 9]));
+var_dump($context->evaluate("sum(aggregate)"));
+
+// generators
+$context->assign('generator', (function() { yield 10; yield 20; yield 30; })());
+var_dump($context->evaluate("sum(generator)"));
+
+// breaking out of the loop
+$context->assign('infinite', (function() { $i = 0; while (true) yield $i++; })());
+var_dump($context->evaluate("var n = 0; for (var x of infinite) if (++n == 5) break; n"));
+
+// exceptions thrown by the iterator
+$context->assign('failing', (function() { yield 1; throw new Exception("failed"); })());
+var_dump($context->evaluate("try { sum(failing); } catch (e) { e.message }"));
+
+// the iterator can also be used by hand
+var_dump($context->evaluate("var it = array[Symbol.iterator](); [it.next().value, it.next().value, it[Symbol.iterator]() === it]"));
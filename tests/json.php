@@ -0,0 +1,57 @@
+<?php
+/**
+ *  Json.php
+ *
+ *  Check passing JSON documents to and from javascript
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+// a large document
+$document = [];
+for ($i = 0; $i < 10000; $i++) $document[] = ['id' => $i, 'name' => "item $i", 'tags' => ['a', 'b'], 'price' => $i / 4];
+$json = json_encode($document);
+
+$context = new JS\Context();
+
+// the document is parsed by v8
+$context->assignJson('document', $json);
+var_dump($context->evaluate("Array.isArray(document) && document.length == 10000 && document[5].name"));
+
+// and can be returned as JSON
+var_dump(json_decode($context->evaluate("document", 0, JS\AsJson), true) === $document);
+
+// values without a JSON representation
+var_dump($context->evaluate("undefined", 0, JS\AsJson));
+var_dump($context->evaluate("'text'", 0, JS\AsJson));
+
+// invalid documents
+try
+{
+    $context->assignJson('invalid', '{"a":');
+}
+catch (Exception $exception)
+{
+    echo($exception->getMessage()."\n");
+}
+
+// cyclic structures
+try
+{
+    $context->evaluate("var x = {}; x.x = x; x", 0, JS\AsJson);
+}
+catch (Exception $exception)
+{
+    echo($exception->getMessage()."\n");
+}
+
+// documents that are not strings are rejected
+try
+{
+    $context->assignJson('invalid', 42);
+}
+catch (Exception $exception)
+{
+    echo($exception->getMessage()."\n");
+}
@@ -0,0 +1,19 @@
+<?php
+/**
+ *  LargeString.php
+ *
+ *  Check passing large strings to javascript without copying them
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$body = str_repeat("Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n", 100000);
+
+$context = new JS\Context();
+
+$context->assign('body', $body);
+
+var_dump($context->evaluate("body.length") == strlen($body));
+var_dump($context->evaluate("body.indexOf('elit')"));
+var_dump($context->evaluate("'ünïcödé '.repeat(10000).length"));
@@ -0,0 +1,26 @@
+<?php
+/**
+ *  LazyArray.php
+ *
+ *  Check reading javascript arrays on demand through JS\Array
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+ini_set('js.lazy_arrays', true);
+
+$context = new JS\Context();
+
+$result = $context->evaluate("Array.from({ length: 1000000 }, (_, i) => i)");
+var_dump($result instanceof JS\Array);
+var_dump(count($result));
+var_dump($result[999999]);
+var_dump(isset($result[1000000]));
+
+$small = $context->evaluate("[1, 'two', [3]]");
+foreach ($small as $key => $value) echo("$key: ".json_encode($value)."\n");
+$small[] = 4;
+var_dump($small->toArray());
+var_dump(is_array($small->toArray()[2]));
+var_dump($small->toArray(1)[2] instanceof JS\Array);
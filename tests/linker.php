@@ -0,0 +1,24 @@
+<?php
+/**
+ *  Linker.php
+ *
+ *  Check the speed of accessing PHP objects from javascript (every access
+ *  has to find the PHP object that belongs to the javascript object)
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+$object = new stdClass;
+$object->x = 1;
+$object->y = 2;
+$context->assign('object', $object);
+$context->assign('list', [1, 2, 3]);
+
+var_dump($context->evaluate("let sum = 0; for (let i = 0; i < 1000; i++) sum += object.x + object.y + list[1]; sum"));
+
+// objects created by scripts are still linked to the same PHP object
+$result = $context->evaluate("globalThis.created = { a: 1 }");
+var_dump($result === $context->evaluate("created"));
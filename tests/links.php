@@ -0,0 +1,30 @@
+<?php
+/**
+ *  Links.php
+ *
+ *  Check passing many PHP objects to javascript, every object is linked
+ *  to the javascript object that wraps it
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+$context->assign('create', function($i) {
+    $object = new stdClass;
+    $object->id = $i;
+    return $object;
+});
+
+var_dump($context->evaluate("let sum = 0; for (let i = 0; i < 200000; i++) sum += create(i).id; sum"));
+
+// the number of links that are still alive (the garbage collector may already have released some)
+$statistics = $context->statistics();
+var_dump($statistics['links'] > 0);
+
+// after a garbage collection, the links of the collected objects are released when the next link is created
+$before = $statistics['links'];
+$context->evaluate("for (let i = 0; i < 200; i++) new Array(1000000).fill(i); 0");
+$context->evaluate("create(0).id");
+var_dump($context->statistics()['links'] < $before);
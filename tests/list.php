@@ -0,0 +1,20 @@
+<?php
+/**
+ *  List.php
+ *
+ *  Check iterating over a large PHP list by index
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+$context->assign('list', range(1, 1000));
+$context->assign('map', ['a' => 1, 10 => 2, 'c' => 3]);
+
+var_dump($context->evaluate("let sum = 0; for (let i = 0; i < list.length; i++) sum += list[i]; sum"));
+
+var_dump($context->evaluate("map.length"));
+var_dump($context->evaluate("map[10]"));
+var_dump($context->evaluate("map.c"));
+var_dump($context->evaluate("list[1000]"));
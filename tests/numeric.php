@@ -0,0 +1,54 @@
+<?php
+/**
+ *  Numeric.php
+ *
+ *  Check moving lists of numbers between PHP and javascript with typed arrays
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+// a vector of floats
+$floats = [];
+for ($i = 0; $i < 100000; $i++) $floats[] = $i / 7;
+
+// assign as Float64Array
+$context->assignNumeric('floats', $floats);
+var_dump($context->evaluate("floats instanceof Float64Array && floats.length == 100000"));
+
+// and back to PHP as array of floats
+var_dump($context->evaluate("floats") === $floats);
+
+// integers end up in an Int32Array, other values are converted the PHP way
+$context->assignNumeric('ints', [1, 2.9, "3", true, null], JS\Int32);
+var_dump($context->evaluate("ints instanceof Int32Array"));
+var_dump($context->evaluate("ints"));
+
+// javascript arrays with numbers
+var_dump($context->evaluate("[1, 2.5, 3]"));
+
+// arrays that start with numbers and end with something else
+var_dump($context->evaluate("[1, 2, 'three', 4]"));
+
+// invalid types are not accepted
+try
+{
+    $context->assignNumeric('invalid', [1, 2, 3], 100);
+}
+catch (Exception $exception)
+{
+    echo($exception->getMessage()."\n");
+}
+try
+{
+    $context->assignNumeric('invalid', 'abc');
+}
+catch (Exception $exception)
+{
+    echo($exception->getMessage()."\n");
+}
+
+// a sparse array does not allocate room for its entire length
+var_dump($context->evaluate("var sparse = [1, 2]; sparse[1000000] = 3; sparse"));
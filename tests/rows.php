@@ -0,0 +1,23 @@
+<?php
+/**
+ *  Rows.php
+ *
+ *  Check converting an array of objects with the same properties into rows
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+$rows = $context->evaluate("Array.from({ length: 1000 }, (_, i) => ({ id: i, name: 'row' + i, active: i % 2 == 0 }))", 0, JS\AsRows);
+var_dump(count($rows));
+var_dump($rows[999]);
+
+print_r($context->evaluate("[{ a: 1, b: 2 }, { a: 3, b: 4 }, { b: 5, a: 6 }, { a: 7 }, 8]", 0, JS\AsRows));
+
+try {
+    $context->evaluate("[{ a: 1 }, { get a() { throw new Error('getter failed'); } }]", 0, JS\AsRows);
+} catch (Exception $exception) {
+    echo($exception->getMessage()."\n");
+}
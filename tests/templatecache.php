@@ -0,0 +1,40 @@
+<?php
+/**
+ *  TemplateCache.php
+ *
+ *  Check the cache of templates per class, with a small cache so that
+ *  classes get evicted
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+ini_set('js.template_cache', 4);
+
+class A { public $x = 1; }
+class B implements ArrayAccess {
+    public function offsetExists($offset): bool { return true; }
+    public function offsetGet($offset): mixed { return $offset; }
+    public function offsetSet($offset, $value): void {}
+    public function offsetUnset($offset): void {}
+}
+class C { public function __invoke() { return 'called'; } }
+
+$context = new JS\Context();
+$context->assign('create', function($i) {
+    switch ($i % 3) {
+    case 0: return new A;
+    case 1: return new B;
+    default: return new C;
+    }
+});
+
+var_dump($context->evaluate("let n = 0; for (let i = 0; i < 300; i++) { const o = create(i); n += (i % 3 == 0) ? o.x : (i % 3 == 1) ? o[1] : o().length; } n"));
+
+// objects of many different classes
+for ($i = 0; $i < 10; $i++) eval("class Dynamic$i {}");
+for ($i = 0; $i < 10; $i++) $context->assign("dynamic$i", new ("Dynamic$i"));
+
+$statistics = $context->statistics();
+var_dump($statistics['templates'] <= 4);
+var_dump($statistics['template_hits'] > 0, $statistics['template_evictions'] > 0);
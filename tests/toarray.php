@@ -0,0 +1,28 @@
+<?php
+/**
+ *  ToArray.php
+ *
+ *  Check converting javascript objects into PHP arrays in one go
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$context = new JS\Context();
+
+$object = $context->evaluate("
+    const shared = { name: 'shared' };
+    const result = { id: 1, title: 'test', tags: ['a', 'b'], first: shared, second: shared, nested: { deep: { deeper: 1 } } };
+    result.self = result;
+    result;
+");
+
+print_r($object->toArray());
+var_dump($object->toArray(1)['nested'] instanceof JS\Object);
+var_dump($object->toArray()['self'] instanceof JS\Object);
+print_r($object->pluck(['id', 'title', 'missing']));
+
+$rows = $context->evaluate("Array.from({ length: 100 }, (_, i) => ({ id: i, name: 'row' + i }))");
+$total = 0;
+foreach ($rows as $row) $total += count($row->pluck(['id', 'name']));
+var_dump($total);
@@ -0,0 +1,32 @@
+<?php
+/**
+ *  ToJsString.php
+ *
+ *  Check that strings are passed to javascript unchanged, with ascii,
+ *  latin-1 and multibyte input
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$corpora = [
+    'ascii'     =>  str_repeat("The quick brown fox jumps over the lazy dog. ", 20),
+    'latin-1'   =>  str_repeat("Le coeur déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter. ", 15),
+    'multibyte' =>  str_repeat("日本語のテキストと English text が混在しています。", 20),
+];
+
+$context = new JS\Context();
+$context->assign('check', function($value) { return strlen($value); });
+
+foreach ($corpora as $name => $string)
+{
+    $context->assign('input', $string);
+    var_dump($context->evaluate("check(input)") == strlen($string));
+
+    // every character (they are all in the basic multilingual plane) is a single code unit in javascript
+    var_dump($context->evaluate("input.length") === count(preg_split('//u', $string, -1, PREG_SPLIT_NO_EMPTY)));
+}
+
+// latin-1 characters keep their code point
+$context->assign('input', "déçu");
+var_dump($context->evaluate("[...input].map(c => c.charCodeAt(0)).join(',')"));
@@ -0,0 +1,37 @@
+<?php
+/**
+ *  ToPhpString.php
+ *
+ *  Check the strings that are returned from javascript,
+ *  with ascii, latin-1 and multibyte characters
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+$corpora = [
+    'ascii'     =>  str_repeat("The quick brown fox jumps over the lazy dog. ", 50),
+    'latin-1'   =>  str_repeat("Le coeur déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter. ", 40),
+    'multibyte' =>  str_repeat("日本語のテキストと English text が混在しています。", 50),
+];
+
+$context = new JS\Context();
+
+foreach ($corpora as $name => $string)
+{
+    // the string should survive the round trip unchanged
+    $context->assign('input', $string);
+    var_dump($context->evaluate("input") === $string);
+
+    // also for strings that are created in javascript
+    var_dump($context->evaluate("input.slice(0, 10) + input.slice(10)") === $string);
+
+    // and for string objects
+    var_dump($context->evaluate("new String(input)") === $string);
+}
+
+// unpaired surrogates are replaced
+var_dump($context->evaluate("'a\\uD800b'") === "a\u{FFFD}b");
+
+// latin-1 characters become the right utf-8 bytes
+var_dump(bin2hex($context->evaluate("'d\\u00e9\\u00e7u'")));
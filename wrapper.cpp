@@ -0,0 +1,122 @@
+/**
+ *  Wrapper.cpp
+ *
+ *  Implementation file for the Wrapper class
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Dependencies
+ */
+#include "wrapper.h"
+#include "link.h"
+#include <v8-cppgc.h>
+#include <cppgc/allocation.h>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  The PHP variables that were released by the garbage collector, and that still have to be destructed
+ *  @var std::vector<Php::Value>
+ */
+std::vector<Php::Value> Wrapper::_released;
+
+/**
+ *  Number of wrappers that are alive
+ *  @var size_t
+ */
+size_t Wrapper::_live = 0;
+
+/**
+ *  Constructor
+ *  @param  isolate     the isolate
+ *  @param  value       the PHP variable
+ */
+Wrapper::Wrapper(v8::Isolate *isolate, const Php::Value &value) :
+    Holder(isolate), _isolate(isolate), _value(value), _size(Link::estimate(value, core()))
+{
+    // one more wrapper
+    ++_live;
+
+    // tell v8 how much memory is kept alive by the object
+    if (_size > 0) isolate->AdjustAmountOfExternalAllocatedMemory(_size);
+}
+
+/**
+ *  Destructor (the finalizer that is called by the garbage collector)
+ */
+Wrapper::~Wrapper()
+{
+    // one wrapper less
+    --_live;
+
+    // the memory is no longer kept alive by the object
+    if (_size > 0) _isolate->AdjustAmountOfExternalAllocatedMemory(-_size);
+
+    // releasing the variable could destruct it (or trigger the PHP garbage collector), which
+    // is not allowed during the garbage collection of v8, so this always has to wait
+    _released.push_back(std::move(_value));
+}
+
+/**
+ *  Release the PHP variable (when the context is disposed)
+ */
+void Wrapper::release()
+{
+    // the memory is no longer kept alive by the object
+    if (_size > 0) _isolate->AdjustAmountOfExternalAllocatedMemory(-_size);
+    _size = 0;
+
+    // forget the variable
+    _value = nullptr;
+}
+
+/**
+ *  Wrap a PHP variable in a javascript object
+ *  @param  isolate     the isolate (it must have a C++ heap)
+ *  @param  object      the javascript object (created from one of our templates)
+ *  @param  value       the PHP variable
+ */
+void Wrapper::wrap(v8::Isolate *isolate, const v8::Local<v8::Object> &object, const Php::Value &value)
+{
+    // this is a good moment to get rid of the variables that were released before
+    purge();
+
+    // allocate the wrapper on the C++ heap of v8
+    auto *wrapper = cppgc::MakeGarbageCollected<Wrapper>(isolate->GetCppHeap()->GetAllocationHandle(), isolate, value);
+
+    // let the javascript object point to it
+    v8::Object::Wrap<tag>(isolate, object, wrapper);
+}
+
+/**
+ *  Get the PHP variable that is wrapped in a javascript object
+ *  @param  isolate     the isolate
+ *  @param  object      the javascript object
+ *  @return Wrapper     nullptr if the object is not wrapped
+ */
+Wrapper *Wrapper::unwrap(v8::Isolate *isolate, const v8::Local<v8::Object> &object)
+{
+    // read the pointer
+    return v8::Object::Unwrap<tag, Wrapper>(isolate, object);
+}
+
+/**
+ *  Destruct the PHP variables that were released during a garbage collection
+ */
+void Wrapper::purge()
+{
+    // take over the variables (destructing them could run PHP code that creates new wrappers)
+    std::vector<Php::Value> released;
+    released.swap(_released);
+}
+
+/**
+ *  End of namespace
+ */
+}
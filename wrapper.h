@@ -0,0 +1,148 @@
+/**
+ *  Wrapper.h
+ *
+ *  When the "js.cppgc_wrappers" setting is enabled, the javascript objects
+ *  that wrap PHP variables do not use a weak Link, but hold a pointer to a
+ *  Wrapper object that is allocated on the C++ heap of v8 (cppgc). This
+ *  wrapper is traced and collected together with the javascript object,
+ *  which is much cheaper for the garbage collector than a weak handle with
+ *  a callback.
+ *
+ *  Releasing the PHP variable could run PHP code, which is not allowed in
+ *  the middle of a garbage collection, so the finalizer of the wrapper only
+ *  queues the variable, and it is released later.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <v8.h>
+#include <cppgc/garbage-collected.h>
+#include <cppgc/visitor.h>
+#include <vector>
+#include "holder.h"
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class Wrapper final : public cppgc::GarbageCollected<Wrapper>, public Holder
+{
+private:
+    /**
+     *  The PHP variables that were released by the garbage collector, and that still have to be destructed
+     *  @var std::vector<Php::Value>
+     */
+    static std::vector<Php::Value> _released;
+
+    /**
+     *  Number of wrappers that are alive
+     *  @var size_t
+     */
+    static size_t _live;
+
+    /**
+     *  The isolate
+     *  @var v8::Isolate
+     */
+    v8::Isolate *_isolate;
+
+    /**
+     *  The PHP variable
+     *  @var Php::Value
+     */
+    Php::Value _value;
+
+    /**
+     *  The estimated size of the PHP variable that was reported to v8
+     *  @var int64_t
+     */
+    int64_t _size;
+
+public:
+    /**
+     *  The tag for the pointer from the javascript object to the wrapper
+     *  @var v8::CppHeapPointerTag
+     */
+    static constexpr v8::CppHeapPointerTag tag = v8::CppHeapPointerTag::kDefaultTag;
+
+    /**
+     *  Constructor
+     *  @param  isolate     the isolate
+     *  @param  value       the PHP variable
+     */
+    Wrapper(v8::Isolate *isolate, const Php::Value &value);
+
+    /**
+     *  No copying
+     *  @param  that
+     */
+    Wrapper(const Wrapper &that) = delete;
+
+    /**
+     *  Destructor (the finalizer that is called by the garbage collector)
+     */
+    ~Wrapper();
+
+    /**
+     *  Release the PHP variable (when the context is disposed)
+     */
+    virtual void release() override;
+
+    /**
+     *  Trace the references to other garbage collected objects (there are none)
+     *  @param  visitor
+     */
+    void Trace(cppgc::Visitor *visitor) const {}
+
+    /**
+     *  The PHP variable
+     *  @return Php::Value
+     */
+    const Php::Value &value() const { return _value; }
+
+    /**
+     *  Wrap a PHP variable in a javascript object
+     *  @param  isolate     the isolate (it must have a C++ heap)
+     *  @param  object      the javascript object (created from one of our templates)
+     *  @param  value       the PHP variable
+     */
+    static void wrap(v8::Isolate *isolate, const v8::Local<v8::Object> &object, const Php::Value &value);
+
+    /**
+     *  Get the PHP variable that is wrapped in a javascript object
+     *  @param  isolate     the isolate
+     *  @param  object      the javascript object
+     *  @return Wrapper     nullptr if the object is not wrapped
+     */
+    static Wrapper *unwrap(v8::Isolate *isolate, const v8::Local<v8::Object> &object);
+
+    /**
+     *  Destruct the PHP variables that were released during a garbage collection
+     */
+    static void purge();
+
+    /**
+     *  Number of wrappers that are alive
+     *  @return size_t
+     */
+    static size_t live() { return _live; }
+};
+
+/**
+ *  End of namespace
+ */
+}
@@ -0,0 +1,115 @@
+/**
+ *  ZendValue.h
+ *
+ *  Helper class to get access to the zval that is wrapped by a Php::Value.
+ *  PHP-CPP does not expose the zval, but on the hot paths we sometimes
+ *  want to skip the PHP-CPP layer and talk to the Zend engine directly.
+ *
+ *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Include guard
+ */
+#pragma once
+
+/**
+ *  Dependencies
+ */
+#include <phpcpp.h>
+#include <php.h>
+
+/**
+ *  Begin of namespace
+ */
+namespace JS {
+
+/**
+ *  Class definition
+ */
+class ZendValue : public Php::Value
+{
+public:
+    /**
+     *  Get the zval that is wrapped by a Php::Value
+     *  @param  value
+     *  @return zval*
+     */
+    static zval *get(const Php::Value &value)
+    {
+        // the member is protected, but we are allowed to form a pointer to it
+        return value.*(&ZendValue::_val);
+    }
+
+    /**
+     *  Create an empty PHP array with room for a certain number of elements
+     *  @param  size        the expected number of elements
+     *  @return Php::Value
+     */
+    static Php::Value array(uint32_t size)
+    {
+        // the result
+        Php::Value result;
+
+        // turn it into an array with room for all elements
+        array_init_size(get(result), size);
+
+        // expose the array
+        return result;
+    }
+
+    /**
+     *  Wrap a newly created PHP string in a Php::Value
+     *  @param  string      the string (the Php::Value takes over the reference)
+     *  @return Php::Value
+     */
+    static Php::Value string(zend_string *string)
+    {
+        // the result
+        Php::Value result;
+
+        // the value is still null, so we can store the string in it without releasing anything
+        ZVAL_STR(get(result), string);
+
+        // expose the string
+        return result;
+    }
+
+    /**
+     *  Add a value to a hashtable under a numeric key
+     *  @param  table       the hashtable
+     *  @param  index       the key
+     *  @param  value       the value to add
+     */
+    static void add(HashTable *table, zend_ulong index, const Php::Value &value)
+    {
+        // the hashtable gets its own reference
+        zval *element = get(value);
+        Z_TRY_ADDREF_P(element);
+
+        // store the element
+        zend_hash_index_update(table, index, element);
+    }
+
+    /**
+     *  Add a value to a hashtable under a string key
+     *  @param  table       the hashtable
+     *  @param  key         the key (MUST be a string)
+     *  @param  value       the value to add
+     */
+    static void add(HashTable *table, const Php::Value &key, const Php::Value &value)
+    {
+        // the hashtable gets its own reference
+        zval *element = get(value);
+        Z_TRY_ADDREF_P(element);
+
+        // store the element (numeric strings are turned into numeric keys, just like PHP does)
+        zend_symtable_update(table, Z_STR_P(get(key)), element);
+    }
+};
+
+/**
+ *  End of namespace
+ */
+}